@@ -0,0 +1,68 @@
+/**
+ * @file fp_big.h
+ * @brief Header of polynomial manipulation in prime fields of large characteristic.
+ * @author Guillaume Roumage
+ * @date 04/2024
+*/
+
+#ifndef FP_BIG_H
+#define FP_BIG_H
+
+#include "../../lib/include/fp_poly.h"
+
+/**
+ * @brief Structure representing a prime field F_p where p is an odd multi-precision prime number.
+ *
+ * The elements of the field are stored on a fixed number of limbs in the Montgomery form, i.e., a is stored as a R mod p with R = 2^(GMP_NUMB_BITS limbs). <br>
+ * The product of two elements is then computed with mpn_mul_n() followed by a Montgomery reduction, without any division.
+ *
+ * @param order The prime number p.
+ * @param limbs The number n of limbs of p.
+ * @param p The n limbs of p.
+ * @param p_inv The inverse of -p modulo 2^GMP_NUMB_BITS.
+ * @param r2 The n limbs of R^2 mod p (used to convert an element to the Montgomery form).
+ * @param one The n limbs of R mod p (the Montgomery form of 1).
+ * @param buffer A scratch buffer of 4n limbs used by the Montgomery reduction.
+*/
+typedef struct fp_big_field_t
+{
+    mpz_t order;
+    size_t limbs;
+    mp_limb_t *p;
+    mp_limb_t p_inv;
+    mp_limb_t *r2;
+    mp_limb_t *one;
+    mp_limb_t *buffer;
+} fp_big_field_t;
+
+/**
+ * @brief Structure representing a polynom over a prime field of large characteristic.
+ *
+ * The coefficients are stored in a single contiguous array of limbs, the coefficient of degree i occupying the limbs [i n, (i + 1) n) in the Montgomery form (see @ref fp_big_field_t). <br>
+ * The leading coefficient is not zero, and the zero polynom has no coefficient.
+ *
+ * @param len The number of coefficients of the polynom (its degree plus one, or 0 for the zero polynom).
+ * @param coeff The len n limbs of the coefficients (may be NULL for the zero polynom).
+*/
+typedef struct fp_big_poly_t
+{
+    size_t len;
+    mp_limb_t *coeff;
+} fp_big_poly_t;
+
+fp_big_field_t *fp_big_init_field(mpz_t);
+fp_poly_error_t fp_big_free_field(fp_big_field_t *);
+fp_big_poly_t *fp_big_poly_init_mpz_array(mpz_t *, size_t, fp_big_field_t *);
+fp_poly_error_t fp_big_poly_free(fp_big_poly_t *);
+fp_poly_error_t fp_big_poly_get_coeff(mpz_t, fp_big_poly_t *, size_t, fp_big_field_t *);
+size_t fp_big_poly_degree(fp_big_poly_t *);
+uint8_t fp_big_poly_is_zero(fp_big_poly_t *);
+uint8_t fp_big_poly_equal(fp_big_poly_t *, fp_big_poly_t *, fp_big_field_t *);
+
+fp_poly_error_t fp_big_poly_add(fp_big_poly_t **, fp_big_poly_t *, fp_big_poly_t *, fp_big_field_t *);
+fp_poly_error_t fp_big_poly_sub(fp_big_poly_t **, fp_big_poly_t *, fp_big_poly_t *, fp_big_field_t *);
+fp_poly_error_t fp_big_poly_mul(fp_big_poly_t **, fp_big_poly_t *, fp_big_poly_t *, fp_big_field_t *);
+fp_poly_error_t fp_big_poly_div(fp_big_poly_t **, fp_big_poly_t **, fp_big_poly_t *, fp_big_poly_t *, fp_big_field_t *);
+fp_poly_error_t fp_big_poly_gcd(fp_big_poly_t **, fp_big_poly_t *, fp_big_poly_t *, fp_big_field_t *);
+
+#endif //FP_BIG_H
@@ -0,0 +1,88 @@
+/**
+ * @file fp_fq.h
+ * @brief Header of the arithmetic of the elements of a Galois field stored on a fixed size.
+ * @author Guillaume Roumage
+ * @date 04/2024
+*/
+
+#ifndef FP_FQ_H
+#define FP_FQ_H
+
+#include "../../lib/include/fp_poly.h"
+
+/**
+ * @brief The maximal degree of the irreducible polynom of a field whose elements are stored in @ref fp_fq_elem_t.
+*/
+#ifndef FP_FQ_MAX_DEGREE
+#define FP_FQ_MAX_DEGREE 64
+#endif
+
+/**
+ * @brief Structure representing an element of a Galois field F_p[x] / (f).
+ *
+ * The element is stored as the coefficients of a polynom of degree lower than n = deg f, inline and without any allocation. <br>
+ * Only the n first coefficients are meaningful, the other ones are ignored. Arrays of elements are thus contiguous in memory.
+ *
+ * For instance, the element 1 + x^2 of F_8 = F_2[x] / (1 + x + x^3) is stored as:
+ * - coeff = [1, 0, 1, ...]
+ *
+ * @param coeff The coefficients of the element (the first element is the coefficient of lowest degree).
+*/
+typedef struct fp_fq_elem_t
+{
+    uint8_t coeff[FP_FQ_MAX_DEGREE];
+} fp_fq_elem_t;
+
+/**
+ * @brief The default number of bits of the digits of the exponents in the fixed-base exponentiation tables.
+*/
+#ifndef FP_FQ_FIXED_BASE_WINDOW
+#define FP_FQ_FIXED_BASE_WINDOW 4
+#endif
+
+/**
+ * @brief Structure representing the precomputed powers of a fixed element g of a Galois field of q elements.
+ *
+ * The exponents are reduced modulo q - 1 and written in base 2^w with d digits. The table stores g^(k 2^(w i)) for each position i < d and each digit 0 < k < 2^w, so that an exponentiation is the product of at most d elements of the table.
+ *
+ * For instance, with w = 2 and d = 3, the table is:
+ * - [g, g^2, g^3, g^4, g^8, g^12, g^16, g^32, g^48]
+ *
+ * @param window The number w of bits of the digits.
+ * @param digits The number d of digits of q - 2.
+ * @param group_order The order q - 1 of the multiplicative group of the field.
+ * @param table The d (2^w - 1) precomputed powers, position by position.
+*/
+typedef struct fp_fq_fixed_base_t
+{
+    size_t window;
+    size_t digits;
+    mpz_t group_order;
+    fp_fq_elem_t *table;
+} fp_fq_fixed_base_t;
+
+uint8_t fp_fq_is_supported(fp_field_t *);
+void fp_fq_zero(fp_fq_elem_t *, fp_field_t *);
+void fp_fq_one(fp_fq_elem_t *, fp_field_t *);
+uint8_t fp_fq_is_zero(const fp_fq_elem_t *, fp_field_t *);
+uint8_t fp_fq_equal(const fp_fq_elem_t *, const fp_fq_elem_t *, fp_field_t *);
+fp_poly_error_t fp_fq_from_poly(fp_fq_elem_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_fq_to_poly(fp_poly_t **, const fp_fq_elem_t *, fp_field_t *);
+
+void fp_fq_add(fp_fq_elem_t *, const fp_fq_elem_t *, const fp_fq_elem_t *, fp_field_t *);
+void fp_fq_sub(fp_fq_elem_t *, const fp_fq_elem_t *, const fp_fq_elem_t *, fp_field_t *);
+void fp_fq_mul(fp_fq_elem_t *, const fp_fq_elem_t *, const fp_fq_elem_t *, fp_field_t *);
+void fp_fq_sqr(fp_fq_elem_t *, const fp_fq_elem_t *, fp_field_t *);
+fp_poly_error_t fp_fq_inv(fp_fq_elem_t *, const fp_fq_elem_t *, fp_field_t *);
+fp_poly_error_t fp_fq_inv_batch(fp_fq_elem_t *, const fp_fq_elem_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_fq_pow(fp_fq_elem_t *, const fp_fq_elem_t *, mpz_t, fp_field_t *);
+fp_fq_fixed_base_t *fp_fq_fixed_base_init(const fp_fq_elem_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_fq_fixed_base_free(fp_fq_fixed_base_t *);
+fp_poly_error_t fp_fq_fixed_base_pow(fp_fq_elem_t *, fp_fq_fixed_base_t *, mpz_t, fp_field_t *);
+
+void fp_fq_add_array(fp_fq_elem_t *, const fp_fq_elem_t *, const fp_fq_elem_t *, size_t, fp_field_t *);
+void fp_fq_sub_array(fp_fq_elem_t *, const fp_fq_elem_t *, const fp_fq_elem_t *, size_t, fp_field_t *);
+void fp_fq_mul_array(fp_fq_elem_t *, const fp_fq_elem_t *, const fp_fq_elem_t *, size_t, fp_field_t *);
+void fp_fq_sqr_array(fp_fq_elem_t *, const fp_fq_elem_t *, size_t, fp_field_t *);
+
+#endif //FP_FQ_H
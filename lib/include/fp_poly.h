@@ -35,6 +35,74 @@
 
 #define FP_VARN 'x'
 
+/**
+ * @brief The maximal number of terms of an irreducible polynom for which the sparse reduction is used (e.g., trinomials and pentanomials).
+*/
+#define FP_POLY_SPARSE_MODULUS_TERMS 5
+
+/**
+ * @brief The minimal length of the operands for which the Karatsuba multiplication is used (the schoolbook method is used below).
+*/
+#ifndef FP_POLY_KARATSUBA_THRESHOLD
+#define FP_POLY_KARATSUBA_THRESHOLD 32
+#endif
+
+/**
+ * @brief The minimal length of the operands for which the half-GCD algorithm is used (the Euclidean algorithm is used below).
+*/
+#ifndef FP_POLY_HGCD_THRESHOLD
+#define FP_POLY_HGCD_THRESHOLD 64
+#endif
+
+/**
+ * @brief The minimal length of the operands for which the greatest common divisor without Bézout coefficients uses the half-GCD algorithm (the in place Euclidean algorithm is used below).
+*/
+#ifndef FP_POLY_GCD_THRESHOLD
+#define FP_POLY_GCD_THRESHOLD 4096
+#endif
+
+/**
+ * @brief The same threshold over F_2, where a step of the in place Euclidean algorithm is a mere XOR of bytes and stays cheaper than the half-GCD for much longer operands.
+*/
+#ifndef FP_POLY_GCD_F2_THRESHOLD
+#define FP_POLY_GCD_F2_THRESHOLD 32768
+#endif
+
+/**
+ * @brief The minimal length of the quotient for which the division by a monic polynom uses the Newton iteration on the reversed divisor (the schoolbook method is used below).
+*/
+#ifndef FP_POLY_NEWTON_THRESHOLD
+#define FP_POLY_NEWTON_THRESHOLD 128
+#endif
+
+/**
+ * @brief The maximal number of points of a node of a subproduct tree below which the remainder tree evaluates the remainder at each point with the Horner method.
+*/
+#ifndef FP_POLY_TREE_HORNER_THRESHOLD
+#define FP_POLY_TREE_HORNER_THRESHOLD 16
+#endif
+
+/**
+ * @brief The number of points evaluated together by the batched Horner method (the lanes of the kernel).
+*/
+#ifndef FP_POLY_HORNER_LANES
+#define FP_POLY_HORNER_LANES 16
+#endif
+
+/**
+ * @brief The maximal number of elements of a Galois field for which the Zech logarithm tables can be built (see fp_poly_init_zech()).
+*/
+#ifndef FP_POLY_ZECH_MAX_ORDER
+#define FP_POLY_ZECH_MAX_ORDER 65536
+#endif
+
+/**
+ * @brief The number of candidates tried when searching a generator of the multiplicative group of a Galois field.
+*/
+#ifndef FP_POLY_ZECH_CANDIDATES
+#define FP_POLY_ZECH_CANDIDATES 256
+#endif
+
 /**
  * @brief Structure representing a polynom.
  * 
@@ -56,18 +124,118 @@ typedef struct fp_poly_t
     list_t *coeff;
 } fp_poly_t;
 
+/**
+ * @brief Structure representing a prepared modulus.
+ *
+ * The irreducible polynom of a field is stored as a dense array of coefficients, together with the data needed by the Barrett reduction. <br>
+ * Once prepared, the reduction of a polynom of degree at most 2n - 2 modulo the irreducible polynom of degree n costs two multiplications and no division.
+ *
+ * For instance, the modulus 1 + x + x^3 over F_2 is stored as:
+ * - degree = 3
+ * - coeff = [1, 1, 0, 1]
+ * - inv_rev = [1, 0] (the inverse of 1 + x^2 + x^3 modulo x^2)
+ * - lc_inv = 1
+ *
+ * @param degree The degree n of the modulus.
+ * @param coeff The n + 1 coefficients of the modulus (the first element is the coefficient of lowest degree).
+ * @param inv_rev The n - 1 coefficients of the inverse of the reversed modulus modulo x^(n - 1).
+ * @param lc_inv The inverse of the leading coefficient of the modulus.
+ * @param sparse_terms The number of terms of degree lower than n when the modulus has at most @ref FP_POLY_SPARSE_MODULUS_TERMS terms, 0 otherwise.
+ * @param sparse_degree The degrees of these terms.
+ * @param sparse_coeff The coefficients of x^n modulo the modulus at these degrees, i.e., -f_k / f_n.
+*/
+typedef struct fp_modulus_t
+{
+    size_t degree;
+    uint8_t *coeff;
+    uint8_t *inv_rev;
+    uint8_t lc_inv;
+    size_t sparse_terms;
+    size_t sparse_degree[FP_POLY_SPARSE_MODULUS_TERMS];
+    uint8_t sparse_coeff[FP_POLY_SPARSE_MODULUS_TERMS];
+} fp_modulus_t;
+
+/**
+ * @brief The number of coefficients of the scratch buffer given to fp_poly_modulus_reduce() and fp_poly_modulus_invmod() for a modulus of degree n.
+ *
+ * The scratch buffer is owned by the caller, so that a prepared modulus is never written after its creation.
+*/
+#define FP_POLY_MODULUS_SCRATCH(n) (4 * (n) + 4)
+
+/**
+ * @brief Structure representing the Zech logarithm tables of a Galois field of q elements.
+ *
+ * Let g be a generator of the multiplicative group of the field. The identifier of the element g^k is k + 1 (0 <= k < q - 1), and the identifier of zero is 0 (so that the identifier of one is 1). <br>
+ * An element a_0 + a_1 x + ... + a_{n-1} x^(n-1) is encoded as the integer a_0 + a_1 p + ... + a_{n-1} p^(n-1).
+ *
+ * For instance, the field F_4 = F_2[x] / (1 + x + x^2) with the generator x is stored as:
+ * - size = 4
+ * - log = [0, 1, 2, 3] (1 = g^0, x = g^1 and 1 + x = g^2)
+ * - exp = [1, 2, 3]
+ * - zech = [0, 3, 2] (1 + 1 = 0, 1 + x = g^2 and 1 + x^2 = x)
+ *
+ * @param size The number q of elements of the field.
+ * @param log The q identifiers of the elements, indexed by their integer encoding.
+ * @param exp The q - 1 integer encodings of the powers of g.
+ * @param zech The q - 1 identifiers of the elements 1 + g^k.
+*/
+typedef struct fp_zech_t
+{
+    size_t size;
+    uint16_t *log;
+    uint16_t *exp;
+    uint16_t *zech;
+} fp_zech_t;
+
+/**
+ * @brief Structure representing the subproduct tree of m points a_0, ..., a_{m-1} of a prime field.
+ *
+ * The level j of the tree holds the monic products of the linear factors (x - a_i) taken by blocks of 2^j consecutive points (the last block may be shorter). <br>
+ * The dense coefficients of the node i of the level j start at index i (2^j + 1) of level[j], and the root is the single node of the last level.
+ *
+ * For instance, the points [1, 2, 3] over F_5 are stored as:
+ * - len = 3
+ * - height = 3
+ * - points = [1, 2, 3]
+ * - level[0] = [4, 1, 3, 1, 2, 1] (x - 1, x - 2 and x - 3)
+ * - level[1] = [2, 2, 1, 2, 1] ((x - 1)(x - 2) = 2 + 2x + x^2 and x - 3)
+ * - level[2] = [4, 1, 4, 1] ((x - 1)(x - 2)(x - 3) = 4 + x + 4x^2 + x^3)
+ *
+ * @param len The number m of points.
+ * @param height The number of levels of the tree.
+ * @param points The m points, reduced modulo the order of the field.
+ * @param level The dense nodes of each level.
+*/
+typedef struct fp_subproduct_tree_t
+{
+    size_t len;
+    size_t height;
+    uint8_t *points;
+    uint8_t **level;
+} fp_subproduct_tree_t;
+
 /**
  * @brief Structure representing a finite field.
- * 
+ *
  * The field is defined by its order and an optionnal irreducible polynom.
- * 
+ *
+ * Once built (including the optional tables, see fp_poly_init_frobenius() and fp_poly_init_zech()), a field is only read by the operations, so it may be shared by several threads.
+ *
  * @param order The order of the field.
  * @param irreducible_polynom The irreducible polynom that defines the field.
+ * @param modulus The prepared modulus built from the irreducible polynom (NULL for a prime field).
+ * @param frobenius The n x n matrix of the map h -> h^p modulo the irreducible polynom, stored row by row (NULL until built by fp_poly_init_frobenius()).
+ * @param inverse The table of the inverses of the integers modulo the order (0 for the integers which are not invertible).
+ * @param zech The Zech logarithm tables (NULL until built by fp_poly_init_zech(), for a field with at most @ref FP_POLY_ZECH_MAX_ORDER elements).
 */
 typedef struct fp_field_t
 {
     uint8_t order;
     fp_poly_t *irreducible_polynom;
+    fp_modulus_t *modulus;
+    uint8_t *frobenius;
+    uint8_t *inverse;
+    fp_zech_t *zech;
 } fp_field_t;
 
 /**
@@ -112,6 +280,7 @@ fp_poly_error_t fp_poly_assert_sizet(fp_poly_t*, size_t, list_t *);
 fp_poly_error_t fp_poly_assert_equality(fp_poly_t *, fp_poly_t *);
 fp_poly_error_t fp_poly_print(FILE*, fp_poly_t *);
 uint8_t fp_poly_is_irreducible(fp_poly_t *p, fp_field_t *f);
+uint8_t fp_poly_is_irreducible_ben_or(fp_poly_t *p, fp_field_t *f);
 
 size_t fp_poly_degree(fp_poly_t *);
 size_t fp_poly_coeff_list_to_degree(fp_poly_t *, size_t);
@@ -124,12 +293,45 @@ fp_poly_error_t fp_poly_sub(fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *
 //fp_poly_error_t fp_poly_mul_single_term(fp_poly_t *, uint8_t, size_t, fp_field_t *);
 fp_poly_error_t fp_poly_mul(fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
 fp_poly_error_t fp_poly_mul_fq(fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_sqr(fp_poly_t **, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_mullow(fp_poly_t **, fp_poly_t *, fp_poly_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_mulhigh(fp_poly_t **, fp_poly_t *, fp_poly_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_mulmid(fp_poly_t **, fp_poly_t *, fp_poly_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_mul_sparse(fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
+uint8_t fp_poly_inv(uint8_t, fp_field_t *);
 fp_poly_error_t fp_poly_div(fp_poly_t **, fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_div_sparse(fp_poly_t **, fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
 fp_poly_error_t fp_poly_gcd(fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
 fp_poly_error_t fp_poly_gcd_extended(fp_poly_t **, fp_poly_t **, fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_invmod(fp_poly_t **, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_powmod(fp_poly_t **, fp_poly_t *, mpz_t, fp_field_t *);
+fp_poly_error_t fp_poly_frobenius(fp_poly_t **, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_trace(uint8_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_compose_mod(fp_poly_t **, fp_poly_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_eval(uint8_t *, fp_poly_t *, uint8_t, fp_field_t *);
+fp_poly_error_t fp_poly_eval_horner(uint8_t *, fp_poly_t *, const uint8_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_eval_multi(uint8_t *, fp_poly_t *, const uint8_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_eval_tree(uint8_t *, fp_poly_t *, fp_subproduct_tree_t *, fp_field_t *);
+fp_poly_error_t fp_poly_interpolate(fp_poly_t **, const uint8_t *, const uint8_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_interpolate_tree(fp_poly_t **, const uint8_t *, fp_subproduct_tree_t *, fp_field_t *);
 
 fp_field_t *fp_poly_init_prime_field(uint8_t);
 fp_field_t *fp_poly_init_galois_field(uint8_t, fp_poly_t *);
 fp_poly_error_t fp_poly_free_field (fp_field_t *);
+fp_poly_error_t fp_poly_modulus_reduce(uint8_t *, size_t, uint8_t *, fp_modulus_t *, uint8_t);
+fp_poly_error_t fp_poly_modulus_invmod(uint8_t *, const uint8_t *, uint8_t *, fp_field_t *);
+fp_poly_error_t fp_poly_modulus_powmod(uint8_t *, const uint8_t *, mpz_t, fp_field_t *);
+fp_poly_error_t fp_poly_init_frobenius(fp_field_t *);
+fp_poly_error_t fp_poly_modulus_frobenius(uint8_t *, const uint8_t *, fp_field_t *);
+fp_poly_error_t fp_poly_modulus_compose(uint8_t *, const uint8_t *, size_t, const uint8_t *, fp_field_t *);
+fp_subproduct_tree_t *fp_poly_subproduct_tree_init(const uint8_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_poly_subproduct_tree_free(fp_subproduct_tree_t *);
+fp_poly_error_t fp_poly_init_zech(fp_field_t *);
+fp_poly_error_t fp_poly_zech_from_poly(uint16_t *, fp_poly_t *, fp_field_t *);
+fp_poly_error_t fp_poly_zech_to_poly(fp_poly_t **, uint16_t, fp_field_t *);
+uint16_t fp_poly_zech_add(uint16_t, uint16_t, fp_field_t *);
+uint16_t fp_poly_zech_mul(uint16_t, uint16_t, fp_field_t *);
+uint16_t fp_poly_zech_inv(uint16_t, fp_field_t *);
+uint16_t fp_poly_zech_pow(uint16_t, mpz_t, fp_field_t *);
 
 #endif //FP_POLY_H
\ No newline at end of file
@@ -0,0 +1,23 @@
+/**
+ * @file fp_series.h
+ * @brief Header of the arithmetic of truncated power series over a prime field.
+ * @author Guillaume Roumage
+ * @date 04/2024
+*/
+
+#ifndef FP_SERIES_H
+#define FP_SERIES_H
+
+#include "../../lib/include/fp_poly.h"
+
+/*
+ * A power series of precision n is represented by a polynom of degree lower than n, i.e., the series modulo x^n. <br>
+ * The coefficients of degree at least n of the arguments are ignored, and the results are reduced modulo x^n.
+ */
+
+fp_poly_error_t fp_series_inv(fp_poly_t **, fp_poly_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_series_sqrt(fp_poly_t **, fp_poly_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_series_log(fp_poly_t **, fp_poly_t *, size_t, fp_field_t *);
+fp_poly_error_t fp_series_exp(fp_poly_t **, fp_poly_t *, size_t, fp_field_t *);
+
+#endif //FP_SERIES_H
@@ -0,0 +1,663 @@
+#include "../include/fp_big.h"
+#include "fp_poly_internal.h"
+
+/**
+ * @brief Copy the absolute value of an mpz_t number to an array of limbs.
+ *
+ * @param dst The array which will store the limbs.
+ * @param x The number (at most \p n limbs).
+ * @param n The number of limbs to write.
+ */
+static void fp_big_limbs_from_mpz(mp_limb_t *dst, const mpz_t x, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        dst[i] = mpz_getlimbn(x, i);
+}
+
+/**
+ * @brief Copy an array of limbs to an mpz_t number.
+ *
+ * @param res The number which will store the limbs.
+ * @param src The array of limbs.
+ * @param n The number of limbs.
+ */
+static void fp_big_limbs_to_mpz(mpz_t res, const mp_limb_t *src, size_t n)
+{
+    mp_limb_t *dst = mpz_limbs_write(res, n);
+    memcpy(dst, src, n * sizeof(mp_limb_t));
+    mpz_limbs_finish(res, n);
+}
+
+/**
+ * @brief Compute the Montgomery reduction T R^-1 mod p of a number T < p R.
+ *
+ * @details At step i, a multiple m p of p is added to T so that its limb i vanishes (m = T_i (-p^-1) mod 2^GMP_NUMB_BITS). <br>
+ * The carry of each step is stored aside and added once at the end, so that each step is a single call to mpn_addmul_1(). The result is lower than 2p before the final subtraction.
+ *
+ * @param res The array which will store the result (n limbs).
+ * @param t The number T (2n limbs, destroyed).
+ * @param field The field.
+ */
+static void fp_big_redc(mp_limb_t *res, mp_limb_t *t, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    mp_limb_t *carries = field->buffer + 2 * n;
+    for (size_t i = 0; i < n; i++)
+        carries[i] = mpn_addmul_1(t + i, field->p, n, t[i] * field->p_inv);
+    mp_limb_t carry = mpn_add_n(res, t + n, carries, n);
+    if (carry || mpn_cmp(res, field->p, n) >= 0)
+        mpn_sub_n(res, res, field->p, n);
+}
+
+/**
+ * @brief Multiply two elements in the Montgomery form.
+ *
+ * @param res The array which will store the product (n limbs, may be \p a or \p b).
+ * @param a The first element (n limbs).
+ * @param b The second element (n limbs).
+ * @param field The field.
+ */
+static void fp_big_mont_mul(mp_limb_t *res, const mp_limb_t *a, const mp_limb_t *b, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    mp_limb_t *t = field->buffer;
+    if (a == b)
+        mpn_sqr(t, a, n);
+    else
+        mpn_mul_n(t, a, b, n);
+    fp_big_redc(res, t, field);
+}
+
+/**
+ * @brief Convert an element from the Montgomery form, i.e., compute a R^-1 mod p.
+ *
+ * @param res The array which will store the element (n limbs, may be \p a).
+ * @param a The element in the Montgomery form (n limbs).
+ * @param field The field.
+ */
+static void fp_big_from_mont(mp_limb_t *res, const mp_limb_t *a, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    mp_limb_t *t = field->buffer;
+    memcpy(t, a, n * sizeof(mp_limb_t));
+    memset(t + n, 0, n * sizeof(mp_limb_t));
+    fp_big_redc(res, t, field);
+}
+
+/**
+ * @brief Add two elements modulo p.
+ *
+ * @param res The array which will store the sum (n limbs, may be \p a or \p b).
+ * @param a The first element (n limbs).
+ * @param b The second element (n limbs).
+ * @param field The field.
+ */
+static void fp_big_add_mod(mp_limb_t *res, const mp_limb_t *a, const mp_limb_t *b, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    mp_limb_t carry = mpn_add_n(res, a, b, n);
+    if (carry || mpn_cmp(res, field->p, n) >= 0)
+        mpn_sub_n(res, res, field->p, n);
+}
+
+/**
+ * @brief Substract two elements modulo p.
+ *
+ * @param res The array which will store the difference (n limbs, may be \p a or \p b).
+ * @param a The first element (n limbs).
+ * @param b The second element (n limbs).
+ * @param field The field.
+ */
+static void fp_big_sub_mod(mp_limb_t *res, const mp_limb_t *a, const mp_limb_t *b, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    if (mpn_sub_n(res, a, b, n))
+        mpn_add_n(res, res, field->p, n);
+}
+
+/**
+ * @brief Compute the inverse of a non zero element in the Montgomery form.
+ *
+ * @details The element is converted from the Montgomery form, inverted with mpz_invert() and converted back.
+ *
+ * @param res The array which will store the inverse (n limbs).
+ * @param a The element (n limbs).
+ * @param field The field.
+ */
+static void fp_big_inv_mod(mp_limb_t *res, const mp_limb_t *a, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    mpz_t x;
+    mpz_init(x);
+    fp_big_from_mont(res, a, field);
+    fp_big_limbs_to_mpz(x, res, n);
+    mpz_invert(x, x, field->order);
+    fp_big_limbs_from_mpz(res, x, n);
+    fp_big_mont_mul(res, res, field->r2, field);
+    mpz_clear(x);
+}
+
+/**
+ * @brief Allocate a polynom with a given number of coefficients set to zero.
+ *
+ * @param len The number of coefficients.
+ * @param field The field.
+ *
+ * @return The polynom, or NULL if the allocation failed.
+ */
+static fp_big_poly_t *fp_big_poly_alloc(size_t len, fp_big_field_t *field)
+{
+    fp_big_poly_t *res = (fp_big_poly_t *) malloc(sizeof(fp_big_poly_t));
+    if (!res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    res->len = len;
+    res->coeff = NULL;
+    if (len == 0)
+        return res;
+    res->coeff = (mp_limb_t *) calloc(len * field->limbs, sizeof(mp_limb_t));
+    if (!res->coeff)
+    {
+        free(res);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    return res;
+}
+
+/**
+ * @brief Remove the leading zero coefficients of a polynom.
+ *
+ * @param p The polynom.
+ * @param field The field.
+ */
+static void fp_big_poly_normalise(fp_big_poly_t *p, fp_big_field_t *field)
+{
+    size_t n = field->limbs;
+    while (p->len > 0 && mpn_zero_p(p->coeff + (p->len - 1) * n, n))
+        p->len--;
+}
+
+/**
+ * @brief Create a prime field of large characteristic.
+ *
+ * @details The Montgomery constants of the field are computed: -p^-1 mod 2^GMP_NUMB_BITS with the Newton iteration, R mod p and R^2 mod p.
+ *
+ * @param order The order of the field, an odd prime number.
+ *
+ * @return The field, or NULL if the order is not an odd prime number or if an allocation failed.
+ */
+fp_big_field_t *fp_big_init_field(mpz_t order)
+{
+    if (mpz_cmp_ui(order, 2) <= 0 || mpz_even_p(order) || mpz_probab_prime_p(order, 25) == 0)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the order is not an odd prime number");
+        return NULL;
+    }
+    fp_big_field_t *field = (fp_big_field_t *) malloc(sizeof(fp_big_field_t));
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    size_t n = mpz_size(order);
+    field->limbs = n;
+    field->p = (mp_limb_t *) malloc(n * sizeof(mp_limb_t));
+    field->r2 = (mp_limb_t *) malloc(n * sizeof(mp_limb_t));
+    field->one = (mp_limb_t *) malloc(n * sizeof(mp_limb_t));
+    field->buffer = (mp_limb_t *) malloc(4 * n * sizeof(mp_limb_t));
+    if (!field->p || !field->r2 || !field->one || !field->buffer)
+    {
+        free(field->p);
+        free(field->r2);
+        free(field->one);
+        free(field->buffer);
+        free(field);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    mpz_init_set(field->order, order);
+    fp_big_limbs_from_mpz(field->p, order, n);
+    // Newton iteration: each step doubles the number of correct bits of p^-1 (p p = 1 mod 8 gives 3 bits)
+    mp_limb_t inv = field->p[0];
+    for (size_t bits = 3; bits < GMP_NUMB_BITS; bits *= 2)
+        inv *= 2 - field->p[0] * inv;
+    field->p_inv = -inv;
+    mpz_t r;
+    mpz_init(r);
+    mpz_setbit(r, n * GMP_NUMB_BITS);
+    mpz_mod(r, r, order);
+    fp_big_limbs_from_mpz(field->one, r, n);
+    mpz_mul(r, r, r);
+    mpz_mod(r, r, order);
+    fp_big_limbs_from_mpz(field->r2, r, n);
+    mpz_clear(r);
+    return field;
+}
+
+/**
+ * @brief Free a prime field of large characteristic.
+ *
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_free_field(fp_big_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    mpz_clear(field->order);
+    free(field->p);
+    free(field->r2);
+    free(field->one);
+    free(field->buffer);
+    free(field);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Create a polynom from an array of mpz_t coefficients.
+ *
+ * @param coeff The coefficients (the first element is the coefficient of lowest degree), reduced modulo p.
+ * @param len The number of coefficients.
+ * @param field The field.
+ *
+ * @return The polynom, or NULL if an error occured.
+ */
+fp_big_poly_t *fp_big_poly_init_mpz_array(mpz_t *coeff, size_t len, fp_big_field_t *field)
+{
+    if (!coeff)
+    {
+        fp_poly_error(FP_POLY_E_LIST_COEFFICIENT_IS_NULL, __FILE__, __func__, __LINE__, "the array of coefficients is NULL");
+        return NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    fp_big_poly_t *res = fp_big_poly_alloc(len, field);
+    if (!res)
+        return NULL;
+    size_t n = field->limbs;
+    mpz_t c;
+    mpz_init(c);
+    for (size_t i = 0; i < len; i++)
+    {
+        mpz_mod(c, coeff[i], field->order);
+        fp_big_limbs_from_mpz(res->coeff + i * n, c, n);
+        fp_big_mont_mul(res->coeff + i * n, res->coeff + i * n, field->r2, field);
+    }
+    mpz_clear(c);
+    fp_big_poly_normalise(res, field);
+    return res;
+}
+
+/**
+ * @brief Free a polynom over a prime field of large characteristic.
+ *
+ * @param p The polynom.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_free(fp_big_poly_t *p)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    free(p->coeff);
+    free(p);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Retrieve a coefficient of a polynom.
+ *
+ * @param res The number which will store the coefficient.
+ * @param p The polynom.
+ * @param degree The degree of the coefficient.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_get_coeff(mpz_t res, fp_big_poly_t *p, size_t degree, fp_big_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (degree >= p->len)
+    {
+        mpz_set_ui(res, 0);
+        return FP_POLY_E_SUCCESS;
+    }
+    size_t n = field->limbs;
+    mp_limb_t *c = field->buffer + 3 * n;
+    fp_big_from_mont(c, p->coeff + degree * n, field);
+    fp_big_limbs_to_mpz(res, c, n);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Retrieve the degree of a polynom (the degree of the zero polynom is 0).
+ *
+ * @param p The polynom.
+ *
+ * @return The degree of the polynom.
+ */
+size_t fp_big_poly_degree(fp_big_poly_t *p)
+{
+    return p->len == 0 ? 0 : p->len - 1;
+}
+
+/**
+ * @brief Check if a polynom is zero.
+ *
+ * @param p The polynom.
+ *
+ * @return 1 if the polynom is zero, 0 otherwise.
+ */
+uint8_t fp_big_poly_is_zero(fp_big_poly_t *p)
+{
+    return p->len == 0;
+}
+
+/**
+ * @brief Check if two polynoms are equal.
+ *
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field.
+ *
+ * @return 1 if the polynoms are equal, 0 otherwise.
+ */
+uint8_t fp_big_poly_equal(fp_big_poly_t *p, fp_big_poly_t *q, fp_big_field_t *field)
+{
+    return p->len == q->len && (p->len == 0 || mpn_cmp(p->coeff, q->coeff, p->len * field->limbs) == 0);
+}
+
+/**
+ * @brief Add or substract two polynoms.
+ *
+ * @param res The parameter which will store the result.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field.
+ * @param is_sub 1 to compute p - q, 0 to compute p + q.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_big_poly_add_aux(fp_big_poly_t **res, fp_big_poly_t *p, fp_big_poly_t *q, fp_big_field_t *field, uint8_t is_sub)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    size_t n = field->limbs, len = p->len > q->len ? p->len : q->len;
+    *res = fp_big_poly_alloc(len, field);
+    if (!*res)
+        return FP_POLY_E_MEMORY;
+    if (p->len)
+        memcpy((*res)->coeff, p->coeff, p->len * n * sizeof(mp_limb_t));
+    for (size_t i = 0; i < q->len; i++)
+    {
+        mp_limb_t *c = (*res)->coeff + i * n;
+        if (is_sub)
+            fp_big_sub_mod(c, c, q->coeff + i * n, field);
+        else
+            fp_big_add_mod(c, c, q->coeff + i * n, field);
+    }
+    fp_big_poly_normalise(*res, field);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Add two polynoms.
+ *
+ * @param res The parameter which will store the sum.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_add(fp_big_poly_t **res, fp_big_poly_t *p, fp_big_poly_t *q, fp_big_field_t *field)
+{
+    return fp_big_poly_add_aux(res, p, q, field, 0);
+}
+
+/**
+ * @brief Substract two polynoms.
+ *
+ * @param res The parameter which will store the difference.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_sub(fp_big_poly_t **res, fp_big_poly_t *p, fp_big_poly_t *q, fp_big_field_t *field)
+{
+    return fp_big_poly_add_aux(res, p, q, field, 1);
+}
+
+/**
+ * @brief Multiply two polynoms.
+ *
+ * @details Each coefficient of the product is a sum of products of coefficients computed with mpn_mul_n() and accumulated without any reduction on 2n + 1 limbs. <br>
+ * The sum is reduced once with mpn_tdiv_qr() and once with the Montgomery reduction (the product of two Montgomery forms carries the factor R^2), instead of one reduction per product.
+ *
+ * @param res The parameter which will store the product.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_mul(fp_big_poly_t **res, fp_big_poly_t *p, fp_big_poly_t *q, fp_big_field_t *field)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (p->len == 0 || q->len == 0)
+    {
+        *res = fp_big_poly_alloc(0, field);
+        return *res ? FP_POLY_E_SUCCESS : FP_POLY_E_MEMORY;
+    }
+    size_t n = field->limbs, len = p->len + q->len - 1;
+    *res = fp_big_poly_alloc(len, field);
+    mp_limb_t *buffer = (mp_limb_t *) malloc((7 * n + 3) * sizeof(mp_limb_t));
+    if (!*res || !buffer)
+    {
+        if (*res)
+            fp_big_poly_free(*res);
+        free(buffer);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    mp_limb_t *acc = buffer, *prod = acc + 2 * n + 1, *quot = prod + 2 * n, *rem = quot + n + 2;
+    for (size_t k = 0; k < len; k++)
+    {
+        memset(acc, 0, (2 * n + 1) * sizeof(mp_limb_t));
+        size_t i_min = k >= q->len ? k - q->len + 1 : 0, i_max = k < p->len ? k : p->len - 1;
+        for (size_t i = i_min; i <= i_max; i++)
+        {
+            mpn_mul_n(prod, p->coeff + i * n, q->coeff + (k - i) * n, n);
+            acc[2 * n] += mpn_add_n(acc, acc, prod, 2 * n);
+        }
+        mpn_tdiv_qr(quot, rem, 0, acc, 2 * n + 1, field->p, n);
+        memset(rem + n, 0, n * sizeof(mp_limb_t));
+        fp_big_redc((*res)->coeff + k * n, rem, field);
+    }
+    free(buffer);
+    fp_big_poly_normalise(*res, field);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Divide two polynoms.
+ *
+ * @param q The parameter which will store the quotient.
+ * @param r The parameter which will store the remainder.
+ * @param n The dividend.
+ * @param d The divisor.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_div(fp_big_poly_t **q, fp_big_poly_t **r, fp_big_poly_t *n, fp_big_poly_t *d, fp_big_field_t *field)
+{
+    if (!n || !d)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (d->len == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "division by zero");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    size_t limbs = field->limbs, len_q = n->len >= d->len ? n->len - d->len + 1 : 0;
+    *q = fp_big_poly_alloc(len_q, field);
+    *r = fp_big_poly_alloc(n->len, field);
+    mp_limb_t *buffer = (mp_limb_t *) malloc(2 * limbs * sizeof(mp_limb_t));
+    if (!*q || !*r || !buffer)
+    {
+        if (*q)
+            fp_big_poly_free(*q);
+        if (*r)
+            fp_big_poly_free(*r);
+        free(buffer);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    if (n->len)
+        memcpy((*r)->coeff, n->coeff, n->len * limbs * sizeof(mp_limb_t));
+    mp_limb_t *lc_inv = buffer, *prod = buffer + limbs;
+    fp_big_inv_mod(lc_inv, d->coeff + (d->len - 1) * limbs, field);
+    for (size_t i = len_q; i > 0; i--)
+    {
+        // r -= c x^(i - 1) d, with c = r_{i - 1 + deg d} / lc(d)
+        mp_limb_t *top = (*r)->coeff + (i - 1 + d->len - 1) * limbs, *c = (*q)->coeff + (i - 1) * limbs;
+        if (mpn_zero_p(top, limbs))
+            continue;
+        fp_big_mont_mul(c, top, lc_inv, field);
+        for (size_t j = 0; j < d->len; j++)
+        {
+            fp_big_mont_mul(prod, c, d->coeff + j * limbs, field);
+            fp_big_sub_mod((*r)->coeff + (i - 1 + j) * limbs, (*r)->coeff + (i - 1 + j) * limbs, prod, field);
+        }
+    }
+    free(buffer);
+    if ((*r)->len > d->len - 1)
+        (*r)->len = d->len - 1;
+    fp_big_poly_normalise(*q, field);
+    fp_big_poly_normalise(*r, field);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Copy a polynom.
+ *
+ * @param p The polynom.
+ * @param field The field.
+ *
+ * @return The copy, or NULL if the allocation failed.
+ */
+static fp_big_poly_t *fp_big_poly_copy(fp_big_poly_t *p, fp_big_field_t *field)
+{
+    fp_big_poly_t *res = fp_big_poly_alloc(p->len, field);
+    if (res && p->len)
+        memcpy(res->coeff, p->coeff, p->len * field->limbs * sizeof(mp_limb_t));
+    return res;
+}
+
+/**
+ * @brief Compute the monic greatest common divisor of two polynoms with the Euclidean algorithm.
+ *
+ * @param res The parameter which will store the greatest common divisor (zero if both polynoms are zero).
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_big_poly_gcd(fp_big_poly_t **res, fp_big_poly_t *p, fp_big_poly_t *q, fp_big_field_t *field)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_big_poly_t *a = fp_big_poly_copy(p, field), *b = fp_big_poly_copy(q, field);
+    if (!a || !b)
+    {
+        if (a)
+            fp_big_poly_free(a);
+        if (b)
+            fp_big_poly_free(b);
+        return FP_POLY_E_MEMORY;
+    }
+    while (b->len)
+    {
+        fp_big_poly_t *quot, *rem;
+        fp_poly_error_t err = fp_big_poly_div(&quot, &rem, a, b, field);
+        if (err != FP_POLY_E_SUCCESS)
+        {
+            fp_big_poly_free(a);
+            fp_big_poly_free(b);
+            return err;
+        }
+        fp_big_poly_free(quot);
+        fp_big_poly_free(a);
+        a = b;
+        b = rem;
+    }
+    fp_big_poly_free(b);
+    if (a->len)
+    {
+        size_t n = field->limbs;
+        mp_limb_t *lc_inv = field->buffer + 3 * n;
+        fp_big_inv_mod(lc_inv, a->coeff + (a->len - 1) * n, field);
+        for (size_t i = 0; i < a->len; i++)
+            fp_big_mont_mul(a->coeff + i * n, a->coeff + i * n, lc_inv, field);
+    }
+    *res = a;
+    return FP_POLY_E_SUCCESS;
+}
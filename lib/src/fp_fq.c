@@ -0,0 +1,544 @@
+#include "../include/fp_fq.h"
+#include "fp_poly_internal.h"
+
+/**
+ * @brief Reduce a product of two elements modulo the irreducible polynom of the field.
+ *
+ * @details The schoolbook division is performed on the 32-bit accumulators of the product: each step adds at most (p - 1)^2 to n accumulators, so the coefficients are reduced modulo p only once per step and once at the end. <br>
+ * For n <= @ref FP_FQ_MAX_DEGREE, this costs as much as the Barrett reduction and needs no scratch buffer.
+ *
+ * @param res The array which will store the remainder (n coefficients).
+ * @param acc The accumulators of the product (2n - 1 coefficients, modified in place).
+ * @param field The field.
+ */
+static void fp_fq_reduce(uint8_t *res, uint32_t *acc, fp_field_t *field)
+{
+    fp_modulus_t *modulus = field->modulus;
+    uint8_t order = field->order;
+    size_t n = modulus->degree;
+    for (size_t i = 2 * n - 2; i >= n; i--)
+    {
+        uint8_t top = acc[i] % order;
+        if (top == 0)
+            continue;
+        // acc -= q x^(i - n) f, with q = acc_i / f_n
+        uint16_t q = order - (uint16_t) top * modulus->lc_inv % order;
+        for (size_t j = 0; j < n; j++)
+            acc[i - n + j] += q * modulus->coeff[j];
+    }
+    for (size_t k = 0; k < n; k++)
+        res[k] = acc[k] % order;
+}
+
+/**
+ * @brief Check if the elements of a field can be stored in @ref fp_fq_elem_t.
+ *
+ * @param field The field.
+ *
+ * @return 1 if the field has a prepared modulus of degree at most @ref FP_FQ_MAX_DEGREE, 0 otherwise.
+ */
+uint8_t fp_fq_is_supported(fp_field_t *field)
+{
+    return field && field->modulus && field->modulus->degree <= FP_FQ_MAX_DEGREE;
+}
+
+/**
+ * @brief Set an element to zero.
+ *
+ * @param res The element.
+ * @param field The field.
+ */
+void fp_fq_zero(fp_fq_elem_t *res, fp_field_t *field)
+{
+    memset(res->coeff, 0, field->modulus->degree);
+}
+
+/**
+ * @brief Set an element to one.
+ *
+ * @param res The element.
+ * @param field The field.
+ */
+void fp_fq_one(fp_fq_elem_t *res, fp_field_t *field)
+{
+    memset(res->coeff, 0, field->modulus->degree);
+    res->coeff[0] = 1 % field->order;
+}
+
+/**
+ * @brief Check if an element is zero.
+ *
+ * @param a The element.
+ * @param field The field.
+ *
+ * @return 1 if the element is zero, 0 otherwise.
+ */
+uint8_t fp_fq_is_zero(const fp_fq_elem_t *a, fp_field_t *field)
+{
+    for (size_t i = 0; i < field->modulus->degree; i++)
+        if (a->coeff[i] != 0)
+            return 0;
+    return 1;
+}
+
+/**
+ * @brief Check if two elements are equal.
+ *
+ * @param a The first element.
+ * @param b The second element.
+ * @param field The field.
+ *
+ * @return 1 if the elements are equal, 0 otherwise.
+ */
+uint8_t fp_fq_equal(const fp_fq_elem_t *a, const fp_fq_elem_t *b, fp_field_t *field)
+{
+    return memcmp(a->coeff, b->coeff, field->modulus->degree) == 0;
+}
+
+/**
+ * @brief Convert a polynom to an element of a field, i.e., reduce it modulo the irreducible polynom.
+ *
+ * @param res The element which will store the polynom.
+ * @param p The polynom.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_from_poly(fp_fq_elem_t *res, fp_poly_t *p, fp_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!fp_fq_is_supported(field))
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no modulus or its degree is larger than FP_FQ_MAX_DEGREE");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = field->modulus->degree, len = fp_poly_degree(p) + 1;
+    uint8_t *dense = (uint8_t *) calloc(len > n ? len : n, 1);
+    if (!dense)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    size_t pos = 0;
+    for (list_node_t *node = p->coeff->head; node; node = node->next, pos++)
+        dense[fp_poly_coeff_list_to_degree(p, pos)] = node->coeff % field->order;
+    uint8_t scratch[FP_POLY_MODULUS_SCRATCH(FP_FQ_MAX_DEGREE)];
+    fp_poly_modulus_reduce(dense, len, scratch, field->modulus, field->order);
+    memcpy(res->coeff, dense, n);
+    free(dense);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Convert an element of a field to a polynom.
+ *
+ * @param res The polynom which will store the element.
+ * @param a The element.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_to_poly(fp_poly_t **res, const fp_fq_elem_t *a, fp_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!fp_fq_is_supported(field))
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no modulus or its degree is larger than FP_FQ_MAX_DEGREE");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    fp_fq_elem_t tmp = *a;
+    *res = fp_poly_init_array(tmp.coeff, field->modulus->degree);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Add two elements of a field.
+ *
+ * @param res The element which will store the sum (may be \p a or \p b).
+ * @param a The first element.
+ * @param b The second element.
+ * @param field The field.
+ */
+void fp_fq_add(fp_fq_elem_t *res, const fp_fq_elem_t *a, const fp_fq_elem_t *b, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    for (size_t i = 0; i < field->modulus->degree; i++)
+    {
+        uint16_t sum = (uint16_t) a->coeff[i] + b->coeff[i];
+        res->coeff[i] = sum >= order ? sum - order : sum;
+    }
+}
+
+/**
+ * @brief Substract two elements of a field.
+ *
+ * @param res The element which will store the difference (may be \p a or \p b).
+ * @param a The first element.
+ * @param b The second element.
+ * @param field The field.
+ */
+void fp_fq_sub(fp_fq_elem_t *res, const fp_fq_elem_t *a, const fp_fq_elem_t *b, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    for (size_t i = 0; i < field->modulus->degree; i++)
+        res->coeff[i] = a->coeff[i] >= b->coeff[i] ? a->coeff[i] - b->coeff[i] : a->coeff[i] + order - b->coeff[i];
+}
+
+/**
+ * @brief Multiply two elements of a field.
+ *
+ * @details The product is accumulated on 32-bit integers (at most @ref FP_FQ_MAX_DEGREE products of two coefficients per term) and reduced on the stack (see fp_fq_reduce()).
+ *
+ * @param res The element which will store the product (may be \p a or \p b).
+ * @param a The first element.
+ * @param b The second element.
+ * @param field The field.
+ */
+void fp_fq_mul(fp_fq_elem_t *res, const fp_fq_elem_t *a, const fp_fq_elem_t *b, fp_field_t *field)
+{
+    size_t n = field->modulus->degree;
+    uint32_t acc[2 * FP_FQ_MAX_DEGREE - 1];
+    memset(acc, 0, (2 * n - 1) * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++)
+    {
+        uint16_t a_i = a->coeff[i];
+        if (a_i == 0)
+            continue;
+        for (size_t j = 0; j < n; j++)
+            acc[i + j] += a_i * b->coeff[j];
+    }
+    fp_fq_reduce(res->coeff, acc, field);
+}
+
+/**
+ * @brief Square an element of a field.
+ *
+ * @details Each cross product a_i a_j (i < j) is computed once and doubled.
+ *
+ * @param res The element which will store the square (may be \p a).
+ * @param a The element.
+ * @param field The field.
+ */
+void fp_fq_sqr(fp_fq_elem_t *res, const fp_fq_elem_t *a, fp_field_t *field)
+{
+    size_t n = field->modulus->degree;
+    uint32_t acc[2 * FP_FQ_MAX_DEGREE - 1];
+    memset(acc, 0, (2 * n - 1) * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++)
+    {
+        uint16_t a_i = a->coeff[i];
+        if (a_i == 0)
+            continue;
+        for (size_t j = i + 1; j < n; j++)
+            acc[i + j] += a_i * a->coeff[j];
+    }
+    for (size_t i = 0; i < n; i++)
+        acc[2 * i] = acc[2 * i] * 2 + (uint16_t) a->coeff[i] * a->coeff[i];
+    for (size_t k = 1; k < 2 * n - 1; k += 2)
+        acc[k] *= 2;
+    fp_fq_reduce(res->coeff, acc, field);
+}
+
+/**
+ * @brief Compute the inverse of an element of a field.
+ *
+ * @details The inverse is computed by fp_poly_modulus_invmod(), in a scratch buffer on the stack.
+ *
+ * @param res The element which will store the inverse (may be \p a).
+ * @param a The element.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_inv(fp_fq_elem_t *res, const fp_fq_elem_t *a, fp_field_t *field)
+{
+    fp_fq_elem_t tmp;
+    uint8_t scratch[FP_POLY_MODULUS_SCRATCH(FP_FQ_MAX_DEGREE)];
+    fp_poly_error_t err = fp_poly_modulus_invmod(tmp.coeff, a->coeff, scratch, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    memcpy(res->coeff, tmp.coeff, field->modulus->degree);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the inverses of an array of elements of a field with the Montgomery trick.
+ *
+ * @details The prefix products c_i = a_0 ... a_{i-1} are stored in \p out, the product of all the elements is inverted once (see fp_fq_inv()), and the inverses are recovered backwards with a_i^-1 = c_i (a_0 ... a_i)^-1. <br>
+ * The whole batch costs one inversion and 3 len multiplications. The zero elements are skipped: their entry in \p out is set to zero, which is never the inverse of an element.
+ *
+ * @param out The array which will store the inverses (must not overlap \p in).
+ * @param in The array of elements.
+ * @param len The number of elements of the arrays.
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_inv_batch(fp_fq_elem_t *out, const fp_fq_elem_t *in, size_t len, fp_field_t *field)
+{
+    fp_fq_elem_t acc;
+    fp_fq_one(&acc, field);
+    for (size_t i = 0; i < len; i++)
+    {
+        out[i] = acc;
+        if (!fp_fq_is_zero(&in[i], field))
+            fp_fq_mul(&acc, &acc, &in[i], field);
+    }
+    fp_poly_error_t err = fp_fq_inv(&acc, &acc, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    for (size_t i = len; i > 0; i--)
+    {
+        if (fp_fq_is_zero(&in[i - 1], field))
+        {
+            fp_fq_zero(&out[i - 1], field);
+            continue;
+        }
+        fp_fq_mul(&out[i - 1], &out[i - 1], &acc, field);
+        fp_fq_mul(&acc, &acc, &in[i - 1], field);
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the power of an element of a field with the square-and-multiply method.
+ *
+ * @param res The element which will store the power (may be \p a).
+ * @param a The element.
+ * @param exponent The exponent (a negative exponent gives a power of the inverse).
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_pow(fp_fq_elem_t *res, const fp_fq_elem_t *a, mpz_t exponent, fp_field_t *field)
+{
+    fp_fq_elem_t base = *a, acc;
+    if (mpz_sgn(exponent) < 0)
+    {
+        fp_poly_error_t err = fp_fq_inv(&base, &base, field);
+        if (err != FP_POLY_E_SUCCESS)
+            return err;
+    }
+    fp_fq_one(&acc, field);
+    // the limbs of the absolute value of the exponent, from the most significant bit
+    for (size_t i = mpz_size(exponent); i > 0; i--)
+    {
+        mp_limb_t limb = mpz_getlimbn(exponent, i - 1);
+        for (size_t j = GMP_NUMB_BITS; j > 0; j--)
+        {
+            fp_fq_sqr(&acc, &acc, field);
+            if ((limb >> (j - 1)) & 1)
+                fp_fq_mul(&acc, &acc, &base, field);
+        }
+    }
+    memcpy(res->coeff, acc.coeff, field->modulus->degree);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Precompute the powers of a fixed non zero element of a field for the fixed-base exponentiation.
+ *
+ * @details See @ref fp_fq_fixed_base_t for the layout of the table. Building it costs d 2^w multiplications, which are paid back after a few exponentiations.
+ *
+ * @param g The fixed element.
+ * @param window The number w of bits of the digits of the exponents (between 1 and 8, or 0 for @ref FP_FQ_FIXED_BASE_WINDOW).
+ * @param field The field.
+ *
+ * @return The precomputed powers, or NULL if an error occured.
+ */
+fp_fq_fixed_base_t *fp_fq_fixed_base_init(const fp_fq_elem_t *g, size_t window, fp_field_t *field)
+{
+    if (!fp_fq_is_supported(field))
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no modulus or its degree is larger than FP_FQ_MAX_DEGREE");
+        return NULL;
+    }
+    if (window == 0)
+        window = FP_FQ_FIXED_BASE_WINDOW;
+    if (window > 8)
+    {
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the window is larger than 8 bits");
+        return NULL;
+    }
+    if (fp_fq_is_zero(g, field))
+    {
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the fixed base is zero");
+        return NULL;
+    }
+    fp_fq_fixed_base_t *res = (fp_fq_fixed_base_t *) malloc(sizeof(fp_fq_fixed_base_t));
+    if (!res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    mpz_init(res->group_order);
+    mpz_ui_pow_ui(res->group_order, field->order, field->modulus->degree);
+    mpz_sub_ui(res->group_order, res->group_order, 1);
+    // the reduced exponents are at most q - 2
+    size_t bits = mpz_cmp_ui(res->group_order, 1) > 0 ? mpz_sizeinbase(res->group_order, 2) : 1;
+    size_t nb_digits = (size_t) 1 << window;
+    res->window = window;
+    res->digits = (bits + window - 1) / window;
+    res->table = (fp_fq_elem_t *) malloc(res->digits * (nb_digits - 1) * sizeof(fp_fq_elem_t));
+    if (!res->table)
+    {
+        mpz_clear(res->group_order);
+        free(res);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    fp_fq_elem_t base = *g;
+    for (size_t i = 0; i < res->digits; i++)
+    {
+        // row i: base^k for 0 < k < 2^w, with base = g^(2^(w i))
+        fp_fq_elem_t *row = res->table + i * (nb_digits - 1);
+        row[0] = base;
+        for (size_t k = 1; k < nb_digits - 1; k++)
+            fp_fq_mul(&row[k], &row[k - 1], &base, field);
+        fp_fq_mul(&base, &row[nb_digits - 2], &base, field);
+    }
+    return res;
+}
+
+/**
+ * @brief Free the precomputed powers of a fixed element.
+ *
+ * @param t The precomputed powers.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_fixed_base_free(fp_fq_fixed_base_t *t)
+{
+    if (!t)
+    {
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the precomputed powers are NULL");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    mpz_clear(t->group_order);
+    free(t->table);
+    free(t);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute a power of a fixed element from its precomputed powers.
+ *
+ * @details The exponent is reduced modulo q - 1 and each of its digits in base 2^w selects one element of the table, so that the exponentiation costs at most d multiplications and no squaring.
+ *
+ * @param res The element which will store the power.
+ * @param t The precomputed powers of the fixed element.
+ * @param exponent The exponent (may be negative).
+ * @param field The field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_fq_fixed_base_pow(fp_fq_elem_t *res, fp_fq_fixed_base_t *t, mpz_t exponent, fp_field_t *field)
+{
+    if (!t)
+    {
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the precomputed powers are NULL");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    mpz_t e;
+    mpz_init(e);
+    mpz_fdiv_r(e, exponent, t->group_order);
+    size_t w = t->window, nb_digits = (size_t) 1 << w;
+    uint8_t is_one = 1;
+    fp_fq_one(res, field);
+    for (size_t i = 0; i < t->digits; i++)
+    {
+        // the digit i spans the bits [w i, w (i + 1)), possibly across two limbs
+        size_t pos = w * i, limb = pos / GMP_NUMB_BITS, shift = pos % GMP_NUMB_BITS;
+        mp_limb_t bits = mpz_getlimbn(e, limb) >> shift;
+        if (shift + w > GMP_NUMB_BITS)
+            bits |= mpz_getlimbn(e, limb + 1) << (GMP_NUMB_BITS - shift);
+        size_t digit = bits & (nb_digits - 1);
+        if (digit == 0)
+            continue;
+        const fp_fq_elem_t *power = &t->table[i * (nb_digits - 1) + digit - 1];
+        if (is_one)
+            memcpy(res->coeff, power->coeff, field->modulus->degree);
+        else
+            fp_fq_mul(res, res, power, field);
+        is_one = 0;
+    }
+    mpz_clear(e);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Add two arrays of elements of a field, element by element.
+ *
+ * @param res The array which will store the sums (may be \p a or \p b).
+ * @param a The first array.
+ * @param b The second array.
+ * @param len The number of elements of the arrays.
+ * @param field The field.
+ */
+void fp_fq_add_array(fp_fq_elem_t *res, const fp_fq_elem_t *a, const fp_fq_elem_t *b, size_t len, fp_field_t *field)
+{
+    for (size_t i = 0; i < len; i++)
+        fp_fq_add(&res[i], &a[i], &b[i], field);
+}
+
+/**
+ * @brief Substract two arrays of elements of a field, element by element.
+ *
+ * @param res The array which will store the differences (may be \p a or \p b).
+ * @param a The first array.
+ * @param b The second array.
+ * @param len The number of elements of the arrays.
+ * @param field The field.
+ */
+void fp_fq_sub_array(fp_fq_elem_t *res, const fp_fq_elem_t *a, const fp_fq_elem_t *b, size_t len, fp_field_t *field)
+{
+    for (size_t i = 0; i < len; i++)
+        fp_fq_sub(&res[i], &a[i], &b[i], field);
+}
+
+/**
+ * @brief Multiply two arrays of elements of a field, element by element.
+ *
+ * @param res The array which will store the products (may be \p a or \p b).
+ * @param a The first array.
+ * @param b The second array.
+ * @param len The number of elements of the arrays.
+ * @param field The field.
+ */
+void fp_fq_mul_array(fp_fq_elem_t *res, const fp_fq_elem_t *a, const fp_fq_elem_t *b, size_t len, fp_field_t *field)
+{
+    for (size_t i = 0; i < len; i++)
+        fp_fq_mul(&res[i], &a[i], &b[i], field);
+}
+
+/**
+ * @brief Square an array of elements of a field, element by element.
+ *
+ * @param res The array which will store the squares (may be \p a).
+ * @param a The array.
+ * @param len The number of elements of the array.
+ * @param field The field.
+ */
+void fp_fq_sqr_array(fp_fq_elem_t *res, const fp_fq_elem_t *a, size_t len, fp_field_t *field)
+{
+    for (size_t i = 0; i < len; i++)
+        fp_fq_sqr(&res[i], &a[i], field);
+}
@@ -1,6 +1,7 @@
 #include "../include/util.h"
 #include "../include/fp_integer.h"
 #include "../include/fp_poly.h"
+#include "fp_poly_internal.h"
 
 /**
  * @brief Print a basic error message with addtionnal information to stderr.
@@ -18,7 +19,7 @@
  * @param line The line where the error occured.
  * @param error The additional information occured.
  */
-static void fp_poly_error(fp_poly_error_t e, const char *file, const char *fct, const int line, const char *error) {
+void fp_poly_error(fp_poly_error_t e, const char *file, const char *fct, const int line, const char *error) {
     switch (e)
     {
         case FP_POLY_E_MEMORY:
@@ -64,7 +65,7 @@ static void fp_poly_error(fp_poly_error_t e, const char *file, const char *fct,
  * @param fct The function where the error occured.
  * @param line The line where the error occured.
 */
-static void fp_poly_error_no_custom_msg(fp_poly_error_t e, const char *file, const char *fct, const int line)
+void fp_poly_error_no_custom_msg(fp_poly_error_t e, const char *file, const char *fct, const int line)
 {
     fp_poly_error(e, file, fct, line, "");
 }
@@ -138,30 +139,6 @@ static fp_poly_error_t fp_poly_normalise_zero_polynom(fp_poly_t *p)
     return FP_POLY_E_SUCCESS;
 }
 
-/**
- * @brief Check if a polynom is a equal to one.
- * 
- * @param p The polynom.
- * 
- * @return A boolean value: 1 if the polynom is one, 0 otherwise.
- */
-static uint8_t fp_poly_is_unit(fp_poly_t *p)
-{
-    if (!p)
-    {
-        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
-        return 0;
-    }
-    if (!p->coeff)
-    {
-        fp_poly_error_no_custom_msg(FP_POLY_E_LIST_COEFFICIENT_IS_NULL, __FILE__, __func__, __LINE__);
-        return 0;
-    }
-    if (p->coeff->size == 1 && mpz_cmp_ui(p->index_coeff, 1) == 0 && p->coeff->head->coeff == 1)
-        return 1;
-    return 0;
-}
-
 /**
  * @brief Compute the degree of a polynom.
  *
@@ -640,251 +617,3911 @@ fp_poly_error_t fp_poly_mul(fp_poly_t **res, fp_poly_t *p, fp_poly_t *q, fp_fiel
 }
 
 /**
- * @brief Retrieve the remainder of the division of the multiplication of two polynoms by an irreducible polynom.
- * 
- * @param res The parameter which will store the remainder of the division.
- * @param p The first polynom.
- * @param q The second polynom.
- * @param f The field in which the operation is performed.
- * 
- * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ * @brief Write the coefficients of a polynom into a dense array.
+ *
+ * @details The array is first filled with zeros, then the coefficient of degree i is written at index i (reduced modulo the order of the field). <br>
+ * Coefficients whose degree is greater than or equal to \p len are ignored.
+ *
+ * @param dst The dense array.
+ * @param len The length of the dense array.
+ * @param p The polynom.
+ * @param order The order of the field.
  */
-fp_poly_error_t fp_poly_mul_fq(fp_poly_t **res, fp_poly_t *p, fp_poly_t *q, fp_field_t *f)
+static void fp_poly_to_dense(uint8_t *dst, size_t len, fp_poly_t *p, uint8_t order)
 {
-    fp_poly_t *tmp_res, *tmp_q, *tmp_r;
-    if (fp_poly_mul(&tmp_res, p, q, f) != FP_POLY_E_SUCCESS)
+    memset(dst, 0, len);
+    size_t degree = 0;
+    list_node_t *node = p->coeff->head;
+    while (node != NULL)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
+        degree = mpz_scan1(p->index_coeff, degree);
+        if (degree >= len)
+            break;
+        dst[degree] = node->coeff % order;
+        node = node->next;
+        degree++;
     }
-    if (fp_poly_div(&tmp_q, &tmp_r, tmp_res, f->irreducible_polynom, f) != FP_POLY_E_SUCCESS)
+}
+
+/**
+ * @brief Multiply two dense polynoms with the schoolbook method.
+ *
+ * @details The product of \p a (of length \p len_a) and \p b (of length \p len_b) is stored in \p res, which must hold len_a + len_b - 1 coefficients and must not overlap \p a or \p b.
+ *
+ * @param res The dense array which will store the product.
+ * @param a The first dense polynom.
+ * @param len_a The length of the first dense polynom.
+ * @param b The second dense polynom.
+ * @param len_b The length of the second dense polynom.
+ * @param order The order of the field.
+ */
+static void fp_poly_dense_mul_basecase(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, uint8_t order)
+{
+    for (size_t k = 0; k < len_a + len_b - 1; k++)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
+        uint64_t acc = 0;
+        size_t i_min = k >= len_b ? k - len_b + 1 : 0;
+        size_t i_max = k < len_a ? k : len_a - 1;
+        for (size_t i = i_min; i <= i_max; i++)
+            acc += (uint16_t) a[i] * b[k - i];
+        res[k] = acc % order;
     }
-    if (fp_poly_free(tmp_res) != FP_POLY_E_SUCCESS)
+}
+
+/**
+ * @brief Multiply two dense polynoms.
+ *
+ * @details Below @ref FP_POLY_KARATSUBA_THRESHOLD coefficients, the schoolbook method is used. <br>
+ * Otherwise, the Karatsuba method is used: with a = a_0 + x^m a_1 and b = b_0 + x^m b_1, the product is a_0 b_0 + x^m ((a_0 + a_1)(b_0 + b_1) - a_0 b_0 - a_1 b_1) + x^(2m) a_1 b_1. <br>
+ * Unbalanced operands are cut into chunks of the length of the shortest one.
+ *
+ * @param res The dense array which will store the product (len_a + len_b - 1 coefficients, must not overlap \p a or \p b).
+ * @param a The first dense polynom.
+ * @param len_a The length of the first dense polynom.
+ * @param b The second dense polynom.
+ * @param len_b The length of the second dense polynom.
+ * @param order The order of the field.
+ */
+static void fp_poly_dense_mul(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, uint8_t order)
+{
+    if (len_a < FP_POLY_KARATSUBA_THRESHOLD || len_b < FP_POLY_KARATSUBA_THRESHOLD)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
+        fp_poly_dense_mul_basecase(res, a, len_a, b, len_b, order);
+        return;
     }
-    if (fp_poly_free(tmp_q) != FP_POLY_E_SUCCESS)
+    if (len_a < len_b)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
+        const uint8_t *tmp = a;
+        a = b;
+        b = tmp;
+        size_t tmp_len = len_a;
+        len_a = len_b;
+        len_b = tmp_len;
     }
-    *res = tmp_r;
-    return FP_POLY_E_SUCCESS;
+    if (len_a >= 2 * len_b)
+    {
+        uint8_t *chunk_res = (uint8_t *) malloc(2 * len_b - 1);
+        if (!chunk_res)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            fp_poly_dense_mul_basecase(res, a, len_a, b, len_b, order);
+            return;
+        }
+        memset(res, 0, len_a + len_b - 1);
+        for (size_t start = 0; start < len_a; start += len_b)
+        {
+            size_t len_chunk = len_a - start < len_b ? len_a - start : len_b;
+            fp_poly_dense_mul(chunk_res, a + start, len_chunk, b, len_b, order);
+            for (size_t i = 0; i < len_chunk + len_b - 1; i++)
+                res[start + i] = (res[start + i] + chunk_res[i]) % order;
+        }
+        free(chunk_res);
+        return;
+    }
+    size_t m = len_a / 2;
+    size_t len_sum_a = len_a - m, len_sum_b = len_b - m > m ? len_b - m : m;
+    size_t len_z0 = 2 * m - 1, len_z2 = len_a + len_b - 2 * m - 1, len_z1 = len_sum_a + len_sum_b - 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_sum_a + len_sum_b + len_z0 + len_z2 + len_z1);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        fp_poly_dense_mul_basecase(res, a, len_a, b, len_b, order);
+        return;
+    }
+    uint8_t *sum_a = buffer, *sum_b = sum_a + len_sum_a, *z0 = sum_b + len_sum_b, *z2 = z0 + len_z0, *z1 = z2 + len_z2;
+    for (size_t i = 0; i < len_sum_a; i++)
+        sum_a[i] = ((i < m ? a[i] : 0) + a[m + i]) % order;
+    for (size_t i = 0; i < len_sum_b; i++)
+        sum_b[i] = ((i < m ? b[i] : 0) + (m + i < len_b ? b[m + i] : 0)) % order;
+    fp_poly_dense_mul(z0, a, m, b, m, order);
+    fp_poly_dense_mul(z2, a + m, len_a - m, b + m, len_b - m, order);
+    fp_poly_dense_mul(z1, sum_a, len_sum_a, sum_b, len_sum_b, order);
+    memset(res, 0, len_a + len_b - 1);
+    memcpy(res, z0, len_z0);
+    memcpy(res + 2 * m, z2, len_z2);
+    for (size_t i = 0; i < len_z1; i++)
+    {
+        uint16_t middle = z1[i] + 2 * order;
+        middle -= i < len_z0 ? z0[i] : 0;
+        middle -= i < len_z2 ? z2[i] : 0;
+        res[m + i] = (res[m + i] + middle) % order;
+    }
+    free(buffer);
 }
 
 /**
- * @brief Compute the inverse of an integer within a field.
- * 
- * @param element The integer.
- * @param field The field.
- * 
- * @return The inverse of the integer within the field or 0 if no inverse is found.
+ * @brief Square a dense polynom.
+ *
+ * @details Below @ref FP_POLY_KARATSUBA_THRESHOLD coefficients, each cross product a_i a_j (i < j) is computed once and doubled, which halves the work of the schoolbook method. <br>
+ * Otherwise, the Karatsuba method needs only three squarings: with a = a_0 + x^m a_1, the square is a_0^2 + x^m ((a_0 + a_1)^2 - a_0^2 - a_1^2) + x^(2m) a_1^2. <br>
+ * Over F_2, the cross products cancel and the square (sum a_i x^i)^2 = sum a_i x^(2i) is computed in linear time.
+ *
+ * @param res The dense array which will store the square (2len - 1 coefficients, must not overlap \p a).
+ * @param a The dense polynom.
+ * @param len The length of the dense polynom.
+ * @param order The order of the field.
  */
-uint8_t fp_poly_inv(uint8_t element, fp_field_t *field)
+static void fp_poly_dense_sqr(uint8_t *res, const uint8_t *a, size_t len, uint8_t order)
 {
-    for (uint8_t i = 1; i < field->order; i++)
-        if ((element * i) % field->order == 1)
-            return i;
-    return 0;
+    if (order == 2)
+    {
+        for (size_t i = 0; i + 1 < len; i++)
+        {
+            res[2 * i] = a[i] & 1;
+            res[2 * i + 1] = 0;
+        }
+        res[2 * len - 2] = a[len - 1] & 1;
+        return;
+    }
+    if (len < FP_POLY_KARATSUBA_THRESHOLD)
+    {
+        for (size_t k = 0; k < 2 * len - 1; k++)
+        {
+            uint64_t acc = 0;
+            size_t i_min = k >= len ? k - len + 1 : 0;
+            for (size_t i = i_min; 2 * i < k; i++)
+                acc += (uint16_t) a[i] * a[k - i];
+            acc *= 2;
+            if (k % 2 == 0)
+                acc += (uint16_t) a[k / 2] * a[k / 2];
+            res[k] = acc % order;
+        }
+        return;
+    }
+    size_t m = len / 2;
+    size_t len_sum = len - m;
+    size_t len_z0 = 2 * m - 1, len_z2 = 2 * len_sum - 1, len_z1 = 2 * len_sum - 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_sum + len_z0 + len_z2 + len_z1);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        fp_poly_dense_mul_basecase(res, a, len, a, len, order);
+        return;
+    }
+    uint8_t *sum = buffer, *z0 = sum + len_sum, *z2 = z0 + len_z0, *z1 = z2 + len_z2;
+    for (size_t i = 0; i < len_sum; i++)
+        sum[i] = ((i < m ? a[i] : 0) + a[m + i]) % order;
+    fp_poly_dense_sqr(z0, a, m, order);
+    fp_poly_dense_sqr(z2, a + m, len_sum, order);
+    fp_poly_dense_sqr(z1, sum, len_sum, order);
+    memset(res, 0, 2 * len - 1);
+    memcpy(res, z0, len_z0);
+    memcpy(res + 2 * m, z2, len_z2);
+    for (size_t i = 0; i < len_z1; i++)
+    {
+        uint16_t middle = z1[i] + 2 * order;
+        middle -= i < len_z0 ? z0[i] : 0;
+        middle -= z2[i];
+        res[m + i] = (res[m + i] + middle) % order;
+    }
+    free(buffer);
 }
 
 /**
- * @brief Divide two polynoms.
- * 
- * @param q The parameter which will store the quotient.
- * @param r The parameter which will store the remainder.
- * @param n The dividend.
- * @param d The divisor.
- * @param f The field in which the division is performed.
- * 
- * @note A field is required since only the multiplication of integer is supported (impossible to multiply an integer by a fraction).
- * 
- * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ * @brief Compute the n lowest coefficients of the product of two dense polynoms.
+ *
+ * @details The schoolbook method only computes the coefficients of degree lower than n, which halves its work for balanced operands. <br>
+ * Above @ref FP_POLY_KARATSUBA_THRESHOLD coefficients, with a = a_0 + x^m a_1 and b = b_0 + x^m b_1, the low product is a_0 b_0 + x^m (a_1 b_0 + a_0 b_1) mod x^n, where a_0 b_0 is a full product of length m and the two other ones are low products of length n - m. <br>
+ * The split m = 0.7 n of Mulders makes the low product about 20% cheaper than the full one with the Karatsuba method (an even split gives almost no saving).
+ *
+ * @param res The dense array which will store the product modulo x^n (n coefficients, must not overlap \p a or \p b).
+ * @param a The first dense polynom.
+ * @param len_a The length of the first dense polynom.
+ * @param b The second dense polynom.
+ * @param len_b The length of the second dense polynom.
+ * @param n The number of coefficients to compute.
+ * @param order The order of the field.
  */
-fp_poly_error_t fp_poly_div(fp_poly_t **q, fp_poly_t **r, fp_poly_t *n, fp_poly_t *d, fp_field_t *f)
+void fp_poly_dense_mullow(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, size_t n, uint8_t order)
 {
-    if ((*r = fp_poly_init_mpz(n->index_coeff, list_copy(n->coeff))) == NULL)
+    len_a = len_a < n ? len_a : n;
+    len_b = len_b < n ? len_b : n;
+    if (len_a == 0 || len_b == 0)
+    {
+        memset(res, 0, n);
+        return;
+    }
+    if (len_a + len_b - 1 <= n)
+    {
+        fp_poly_dense_mul(res, a, len_a, b, len_b, order);
+        memset(res + len_a + len_b - 1, 0, n - (len_a + len_b - 1));
+        return;
+    }
+    size_t m = (7 * n + 9) / 10, len_a0 = len_a < m ? len_a : m, len_b0 = len_b < m ? len_b : m;
+    uint8_t *buffer = NULL;
+    if (len_a >= FP_POLY_KARATSUBA_THRESHOLD && len_b >= FP_POLY_KARATSUBA_THRESHOLD)
+    {
+        buffer = (uint8_t *) malloc(2 * m - 1 + 2 * (n - m));
+        if (!buffer)
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+    }
+    if (!buffer)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            uint64_t acc = 0;
+            size_t i_min = k >= len_b ? k - len_b + 1 : 0;
+            size_t i_max = k < len_a ? k : len_a - 1;
+            for (size_t i = i_min; i <= i_max; i++)
+                acc += (uint16_t) a[i] * b[k - i];
+            res[k] = acc % order;
+        }
+        return;
+    }
+    uint8_t *low = buffer, *cross_a = low + 2 * m - 1, *cross_b = cross_a + n - m;
+    size_t len_low = len_a0 + len_b0 - 1;
+    fp_poly_dense_mul(low, a, len_a0, b, len_b0, order);
+    fp_poly_dense_mullow(cross_a, a + m, len_a > m ? len_a - m : 0, b, len_b0, n - m, order);
+    fp_poly_dense_mullow(cross_b, a, len_a0, b + m, len_b > m ? len_b - m : 0, n - m, order);
+    memcpy(res, low, m < len_low ? m : len_low);
+    if (len_low < m)
+        memset(res + len_low, 0, m - len_low);
+    for (size_t k = m; k < n; k++)
+        res[k] = ((k < len_low ? low[k] : 0) + cross_a[k - m] + cross_b[k - m]) % order;
+    free(buffer);
+}
+
+/**
+ * @brief Compute the coefficients of degree at least n of the product of two dense polynoms.
+ *
+ * @details Since the reversal of a product is the product of the reversals, the high product is the reversal of the low product of length len_a + len_b - 1 - n of the reversed operands (see fp_poly_dense_mullow()).
+ *
+ * @param res The dense array which will store the product divided by x^n (len_a + len_b - 1 - n coefficients, must not overlap \p a or \p b).
+ * @param a The first dense polynom.
+ * @param len_a The length of the first dense polynom.
+ * @param b The second dense polynom.
+ * @param len_b The length of the second dense polynom.
+ * @param n The number of low coefficients to skip (lower than len_a + len_b - 1).
+ * @param order The order of the field.
+ */
+static void fp_poly_dense_mulhigh(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, size_t n, uint8_t order)
+{
+    size_t len = len_a + len_b - 1 - n;
+    uint8_t *buffer = (uint8_t *) malloc(len_a + len_b + len);
+    if (!buffer)
     {
         fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
-        return FP_POLY_E_MEMORY;
+        memset(res, 0, len);
+        return;
     }
-    if ((*q = fp_poly_init()) == NULL)
+    uint8_t *rev_a = buffer, *rev_b = rev_a + len_a, *low = rev_b + len_b;
+    for (size_t i = 0; i < len_a; i++)
+        rev_a[i] = a[len_a - 1 - i];
+    for (size_t i = 0; i < len_b; i++)
+        rev_b[i] = b[len_b - 1 - i];
+    fp_poly_dense_mullow(low, rev_a, len_a, rev_b, len_b, len, order);
+    for (size_t i = 0; i < len; i++)
+        res[i] = low[len - 1 - i];
+    free(buffer);
+}
+
+/**
+ * @brief Compute the middle product of two dense polynoms, i.e., the coefficients of degree n - 1 to 2n - 2 of the product of a polynom of length 2n - 1 by a polynom of length n.
+ *
+ * @details The middle product is the transposition of the multiplication by \p b, and it costs one product of length n instead of two. <br>
+ * Below @ref FP_POLY_KARATSUBA_THRESHOLD coefficients, each c_k = sum_j a_{n - 1 + k - j} b_j is computed directly. Otherwise, with n = 2h, a cut into the three overlapping blocks a_0 = a[0, 2h - 1), a_1 = a[h, 3h - 1) and a_2 = a[2h, 4h - 1), and b = b_0 + x^h b_1, the transposed Karatsuba method computes alpha = mid(a_0 + a_1, b_1), beta = mid(a_1, b_0 - b_1) and gamma = mid(a_1 + a_2, b_0), and the result is (alpha + beta) + x^h (gamma - beta). <br>
+ * An odd length is handled by prepending a zero to \p b and appending a zero to \p a.
+ *
+ * @param res The dense array which will store the middle product (n coefficients, must not overlap \p a or \p b).
+ * @param a The first dense polynom (2n - 1 coefficients).
+ * @param b The second dense polynom (n coefficients).
+ * @param n The length of the middle product.
+ * @param order The order of the field.
+ */
+void fp_poly_dense_mulmid(uint8_t *res, const uint8_t *a, const uint8_t *b, size_t n, uint8_t order)
+{
+    if (n < FP_POLY_KARATSUBA_THRESHOLD)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            uint64_t acc = 0;
+            for (size_t j = 0; j < n; j++)
+                acc += (uint16_t) a[n - 1 + k - j] * b[j];
+            res[k] = acc % order;
+        }
+        return;
+    }
+    if (n % 2 == 1)
+    {
+        uint8_t *buffer = (uint8_t *) malloc(2 * n + 1 + 2 * (n + 1));
+        if (!buffer)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            memset(res, 0, n);
+            return;
+        }
+        uint8_t *a_pad = buffer, *b_pad = a_pad + 2 * n + 1, *res_pad = b_pad + n + 1;
+        memcpy(a_pad, a, 2 * n - 1);
+        a_pad[2 * n - 1] = 0;
+        a_pad[2 * n] = 0;
+        b_pad[0] = 0;
+        memcpy(b_pad + 1, b, n);
+        fp_poly_dense_mulmid(res_pad, a_pad, b_pad, n + 1, order);
+        memcpy(res, res_pad, n);
+        free(buffer);
+        return;
+    }
+    size_t h = n / 2;
+    uint8_t *buffer = (uint8_t *) malloc(2 * (2 * h - 1) + 4 * h);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        memset(res, 0, n);
+        return;
+    }
+    uint8_t *sum_01 = buffer, *sum_12 = sum_01 + 2 * h - 1, *diff_b = sum_12 + 2 * h - 1, *beta = diff_b + h, *alpha = beta + h;
+    for (size_t i = 0; i + 1 < 2 * h; i++)
+    {
+        sum_01[i] = (a[i] + a[h + i]) % order;
+        sum_12[i] = (a[h + i] + a[2 * h + i]) % order;
+    }
+    for (size_t i = 0; i < h; i++)
+        diff_b[i] = (b[i] + order - b[h + i]) % order;
+    fp_poly_dense_mulmid(alpha, sum_01, b + h, h, order);
+    fp_poly_dense_mulmid(beta, a + h, diff_b, h, order);
+    fp_poly_dense_mulmid(res + h, sum_12, b, h, order);
+    for (size_t i = 0; i < h; i++)
+    {
+        res[i] = (alpha[i] + beta[i]) % order;
+        res[h + i] = (res[h + i] + order - beta[i]) % order;
+    }
+    free(buffer);
+}
+
+/**
+ * @brief Free a prepared modulus.
+ *
+ * @param modulus The prepared modulus.
+ */
+static void fp_poly_modulus_free(fp_modulus_t *modulus)
+{
+    free(modulus->coeff);
+    free(modulus->inv_rev);
+    free(modulus);
+}
+
+/**
+ * @brief Prepare the modulus of a Galois field for the Barrett reduction.
+ *
+ * @details The inverse of the reversed modulus modulo x^(n - 1) is computed once with a schoolbook power series inversion, so that every later reduction only requires two multiplications. <br>
+ * No modulus is prepared if the irreducible polynom is constant or if its leading coefficient is not invertible.
+ *
+ * @param irreducible_polynom The irreducible polynom.
+ * @param field The field (only its order is used).
+ *
+ * @return The prepared modulus if the operation was successful or NULL otherwise.
+ */
+static fp_modulus_t *fp_poly_modulus_init(fp_poly_t *irreducible_polynom, fp_field_t *field)
+{
+    size_t n = fp_poly_degree(irreducible_polynom);
+    if (n == 0)
+        return NULL;
+    fp_modulus_t *modulus = (fp_modulus_t *) malloc(sizeof(fp_modulus_t));
+    if (!modulus)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    modulus->degree = n;
+    modulus->coeff = (uint8_t *) malloc(n + 1);
+    modulus->inv_rev = (uint8_t *) malloc(n);
+    if (!modulus->coeff || !modulus->inv_rev)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        fp_poly_modulus_free(modulus);
+        return NULL;
+    }
+    fp_poly_to_dense(modulus->coeff, n + 1, irreducible_polynom, field->order);
+    modulus->lc_inv = fp_poly_inv(modulus->coeff[n], field);
+    if (modulus->lc_inv == 0)
+    {
+        fp_poly_modulus_free(modulus);
+        return NULL;
+    }
+    // inv_rev = 1 / rev(f) mod x^(n - 1), where rev(f)[i] = f[n - i]
+    for (size_t k = 0; k + 1 < n; k++)
+    {
+        if (k == 0)
+        {
+            modulus->inv_rev[0] = modulus->lc_inv;
+            continue;
+        }
+        uint64_t acc = 0;
+        for (size_t i = 1; i <= k; i++)
+            acc += (uint16_t) modulus->coeff[n - i] * modulus->inv_rev[k - i];
+        acc %= field->order;
+        modulus->inv_rev[k] = ((field->order - acc) % field->order) * modulus->lc_inv % field->order;
+    }
+    // trinomials, pentanomials, etc. are reduced term by term (see fp_poly_modulus_reduce_sparse())
+    modulus->sparse_terms = 0;
+    if (irreducible_polynom->coeff->size <= FP_POLY_SPARSE_MODULUS_TERMS)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            if (modulus->coeff[k] == 0)
+                continue;
+            modulus->sparse_degree[modulus->sparse_terms] = k;
+            modulus->sparse_coeff[modulus->sparse_terms] = (field->order - modulus->coeff[k]) * modulus->lc_inv % field->order;
+            modulus->sparse_terms++;
+        }
+    }
+    return modulus;
+}
+
+/**
+ * @brief Reduce a window of at most 2n - 1 coefficients modulo a prepared modulus of degree n >= 2.
+ *
+ * @details Let A be the window. The quotient Q of A by the modulus f has degree at most n - 2, and its reversal is given by rev(Q) = rev(A) * inv_rev mod x^(n - 1). <br>
+ * The remainder is then A - Q * f, of which only the n lowest coefficients are computed. The quotient itself is never handed back.
+ * Above @ref FP_POLY_KARATSUBA_THRESHOLD coefficients, both products are computed by fp_poly_dense_mullow() in the second half of the scratch buffer.
+ *
+ * @param a The window (updated in place, only its n lowest coefficients are meaningful afterwards).
+ * @param len The length of the window (between n + 1 and 2n - 1).
+ * @param scratch A scratch buffer of at least 4n coefficients.
+ * @param modulus The prepared modulus.
+ * @param order The order of the field.
+ */
+static void fp_poly_modulus_reduce_window(uint8_t *a, size_t len, uint8_t *scratch, fp_modulus_t *modulus, uint8_t order)
+{
+    size_t n = modulus->degree;
+    uint8_t *top = scratch;
+    uint8_t *quot_rev = scratch + n - 1;
+    // the n - 1 highest coefficients of A in reverse order
+    for (size_t i = 0; i + 1 < n; i++)
+        top[i] = (2 * n - 2 - i < len) ? a[2 * n - 2 - i] : 0;
+    if (n - 1 >= FP_POLY_KARATSUBA_THRESHOLD)
+    {
+        // both multiplications are low products computed by fp_poly_dense_mullow()
+        uint8_t *prod = scratch + 2 * n - 2;
+        fp_poly_dense_mullow(prod, top, n - 1, modulus->inv_rev, n - 1, n - 1, order);
+        for (size_t k = 0; k + 1 < n; k++)
+            top[k] = prod[n - 2 - k];
+        fp_poly_dense_mullow(prod, top, n - 1, modulus->coeff, n + 1, n, order);
+        for (size_t k = 0; k < n; k++)
+            a[k] = (a[k] + order - prod[k]) % order;
+        return;
+    }
+    // first multiplication: rev(Q) = top * inv_rev mod x^(n - 1)
+    for (size_t k = 0; k + 1 < n; k++)
+    {
+        uint64_t acc = 0;
+        for (size_t i = 0; i <= k; i++)
+            acc += (uint16_t) top[i] * modulus->inv_rev[k - i];
+        quot_rev[k] = acc % order;
+    }
+    // second multiplication: A = A - Q * f mod x^n, with Q[j] = quot_rev[n - 2 - j]
+    for (size_t k = 0; k < n; k++)
+    {
+        uint64_t acc = 0;
+        size_t j_max = k < n - 2 ? k : n - 2;
+        for (size_t j = 0; j <= j_max; j++)
+            acc += (uint16_t) quot_rev[n - 2 - j] * modulus->coeff[k - j];
+        a[k] = (a[k] + order - acc % order) % order;
+    }
+}
+
+/**
+ * @brief Reduce a dense polynom modulo a prepared modulus with few terms.
+ *
+ * @details Since x^n = sum c_k x^k modulo the modulus (where the sum runs over its few lower terms), the coefficient of degree i >= n is folded onto the degrees i - n + k. <br>
+ * Going from the highest degree downwards, each coefficient costs one multiply-add per term, instead of a full Barrett reduction.
+ *
+ * @param a The dense polynom (updated in place).
+ * @param len The length of the dense polynom.
+ * @param modulus The prepared modulus.
+ * @param order The order of the field.
+ */
+static void fp_poly_modulus_reduce_sparse(uint8_t *a, size_t len, fp_modulus_t *modulus, uint8_t order)
+{
+    size_t n = modulus->degree;
+    if (order == 2)
+    {
+        for (size_t i = len - 1; i >= n; i--)
+            if (a[i])
+                for (size_t t = 0; t < modulus->sparse_terms; t++)
+                    a[i - n + modulus->sparse_degree[t]] ^= 1;
+        return;
+    }
+    for (size_t i = len - 1; i >= n; i--)
+    {
+        if (a[i] == 0)
+            continue;
+        for (size_t t = 0; t < modulus->sparse_terms; t++)
+        {
+            size_t j = i - n + modulus->sparse_degree[t];
+            a[j] = (a[j] + (uint16_t) a[i] * modulus->sparse_coeff[t]) % order;
+        }
+    }
+}
+
+/**
+ * @brief Reduce a dense polynom modulo a prepared modulus.
+ *
+ * @details If the modulus has at most @ref FP_POLY_SPARSE_MODULUS_TERMS terms, the reduction is performed by fp_poly_modulus_reduce_sparse(). <br>
+ * Otherwise, the polynom is reduced in place by windows of 2n - 1 coefficients, starting from the highest degree. <br>
+ * Once done, the n lowest coefficients of \p a hold the remainder (the other ones are left unspecified).
+ *
+ * @param a The dense polynom (the first element is the coefficient of lowest degree).
+ * @param len The length of the dense polynom.
+ * @param scratch A scratch buffer of @ref FP_POLY_MODULUS_SCRATCH(n) coefficients, owned by the caller.
+ * @param modulus The prepared modulus.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_modulus_reduce(uint8_t *a, size_t len, uint8_t *scratch, fp_modulus_t *modulus, uint8_t order)
+{
+    if (!a || !scratch)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = modulus->degree;
+    if (n == 1)
+    {
+        // the remainder modulo f_1 * x + f_0 is the evaluation at the root -f_0 / f_1
+        uint8_t root = (order - modulus->coeff[0]) % order * modulus->lc_inv % order;
+        uint8_t value = 0;
+        for (size_t i = len; i > 0; i--)
+            value = ((uint16_t) value * root + a[i - 1]) % order;
+        a[0] = value;
+        return FP_POLY_E_SUCCESS;
+    }
+    if (modulus->sparse_terms != 0)
+    {
+        if (len > n)
+            fp_poly_modulus_reduce_sparse(a, len, modulus, order);
+        return FP_POLY_E_SUCCESS;
+    }
+    while (len > n)
+    {
+        size_t start = len >= 2 * n - 1 ? len - (2 * n - 1) : 0;
+        fp_poly_modulus_reduce_window(a + start, len - start, scratch, modulus, order);
+        len = start + n;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Spread the bits of an mpz_t number, i.e., move the bit i to the bit 2i.
+ *
+ * @details The limbs are spread byte by byte with a table of 256 entries of 16 bits, so the cost is linear in the size of \p a. <br>
+ * Over F_2, this maps the index of the coefficients of a polynom to the index of the coefficients of its square.
+ *
+ * @param res The mpz_t number which will store the spread bits (must be different from \p a).
+ * @param a The mpz_t number.
+ */
+static void fp_poly_spread_bits(mpz_t res, const mpz_t a)
+{
+    static uint16_t table[256];
+    static uint8_t is_table_ready = 0;
+    if (!is_table_ready)
+    {
+        for (uint16_t b = 0; b < 256; b++)
+        {
+            uint16_t spread = 0;
+            for (uint8_t i = 0; i < 8; i++)
+                spread |= ((b >> i) & 1) << (2 * i);
+            table[b] = spread;
+        }
+        is_table_ready = 1;
+    }
+    size_t size = mpz_size(a);
+    if (size == 0)
+    {
+        mpz_set_ui(res, 0);
+        return;
+    }
+    mp_limb_t *dst = mpz_limbs_write(res, 2 * size);
+    const mp_limb_t *src = mpz_limbs_read(a);
+    const size_t half = GMP_NUMB_BITS / 2;
+    for (size_t i = 0; i < size; i++)
+    {
+        mp_limb_t low = 0, high = 0;
+        for (size_t j = 0; j < half; j += 8)
+        {
+            low |= (mp_limb_t) table[(src[i] >> j) & 0xff] << (2 * j);
+            high |= (mp_limb_t) table[(src[i] >> (half + j)) & 0xff] << (2 * j);
+        }
+        dst[2 * i] = low;
+        dst[2 * i + 1] = high;
+    }
+    mpz_limbs_finish(res, 2 * size);
+}
+
+/**
+ * @brief Square a polynom.
+ *
+ * @details Over F_2, the square of sum a_i x^i is sum a_i x^(2i): the odd coefficients become 1, the even ones are dropped, and the index of the remaining coefficients is spread (see fp_poly_spread_bits()), in time linear in the degree. <br>
+ * Otherwise, the square is computed on a dense array with the symmetric kernel (see fp_poly_dense_sqr()), which needs about half the products of fp_poly_mul(). <br>
+ * As for fp_poly_mul(), the result is not reduced modulo the irreducible polynom of the field.
+ *
+ * @param res The parameter which will store the square.
+ * @param p The polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_sqr(fp_poly_t **res, fp_poly_t *p, fp_field_t *f)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!p->coeff)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_LIST_COEFFICIENT_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_LIST_COEFFICIENT_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (f->order == 2)
+    {
+        *res = (fp_poly_t *) malloc(sizeof(fp_poly_t));
+        if (!*res)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            return FP_POLY_E_MEMORY;
+        }
+        (*res)->coeff = list_init();
+        if (!(*res)->coeff)
+        {
+            free(*res);
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            return FP_POLY_E_MEMORY;
+        }
+        // the coefficients are reduced modulo 2: only the odd ones are kept, and they become 1
+        mpz_t odd;
+        mpz_init(odd);
+        mp_bitcnt_t d = 0;
+        for (list_node_t *node = p->coeff->head; node != NULL; node = node->next, d++)
+        {
+            d = mpz_scan1(p->index_coeff, d);
+            if (node->coeff & 1)
+                mpz_setbit(odd, d);
+        }
+        mpz_init((*res)->index_coeff);
+        size_t terms = mpz_popcount(odd);
+        if (terms == 0)
+            mpz_set_ui((*res)->index_coeff, 0x1);
+        else
+            fp_poly_spread_bits((*res)->index_coeff, odd);
+        mpz_clear(odd);
+        for (size_t i = 0; i < (terms == 0 ? 1 : terms); i++)
+        {
+            if (list_add_end((*res)->coeff, terms != 0) != LIST_E_SUCCESS)
+            {
+                fp_poly_free(*res);
+                fp_poly_error(FP_POLY_E_LIST_COEFFICIENT, __FILE__, __func__, __LINE__, "list_add_end() failed");
+                return FP_POLY_E_LIST_COEFFICIENT;
+            }
+        }
+        return FP_POLY_E_SUCCESS;
+    }
+    size_t len = fp_poly_degree(p) + 1;
+    uint8_t *buffer = (uint8_t *) malloc(3 * len - 1);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *dense = buffer, *square = buffer + len;
+    fp_poly_to_dense(dense, len, p, f->order);
+    fp_poly_dense_sqr(square, dense, len, f->order);
+    *res = fp_poly_init_array(square, 2 * len - 1);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Check the operands of the truncated products and write them into dense arrays.
+ *
+ * @param buffer The parameter which will store the dense arrays of \p a and \p b, followed by \p extra free coefficients.
+ * @param len_a The length of the dense array of \p a.
+ * @param len_b The length of the dense array of \p b.
+ * @param a The first polynom.
+ * @param b The second polynom.
+ * @param extra The number of free coefficients after the dense arrays.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_truncated_operands(uint8_t **buffer, size_t len_a, size_t len_b, fp_poly_t *a, fp_poly_t *b, size_t extra, fp_field_t *field)
+{
+    if (!a || !b)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    *buffer = (uint8_t *) malloc(len_a + len_b + extra);
+    if (!*buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_to_dense(*buffer, len_a, a, field->order);
+    fp_poly_to_dense(*buffer + len_a, len_b, b, field->order);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the product of two polynoms modulo x^n.
+ *
+ * @details Only the coefficients of degree lower than n of the operands are read, and only the coefficients of degree lower than n of the product are computed (see fp_poly_dense_mullow()).
+ *
+ * @param res The polynom which will store a b mod x^n.
+ * @param a The first polynom.
+ * @param b The second polynom.
+ * @param n The precision (non zero).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_mullow(fp_poly_t **res, fp_poly_t *a, fp_poly_t *b, size_t n, fp_field_t *field)
+{
+    if (n == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the precision is zero");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    size_t len_a = a ? fp_poly_degree(a) + 1 : 0, len_b = b ? fp_poly_degree(b) + 1 : 0;
+    len_a = len_a < n ? len_a : n;
+    len_b = len_b < n ? len_b : n;
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_poly_truncated_operands(&buffer, len_a, len_b, a, b, n, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    uint8_t *low = buffer + len_a + len_b;
+    fp_poly_dense_mullow(low, buffer, len_a, buffer + len_a, len_b, n, field->order);
+    *res = fp_poly_init_array(low, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the product of two polynoms divided by x^n, i.e., the coefficients of degree at least n of the product.
+ *
+ * @details The coefficients of degree lower than n are not computed (see fp_poly_dense_mulhigh()).
+ *
+ * @param res The polynom which will store a b div x^n.
+ * @param a The first polynom.
+ * @param b The second polynom.
+ * @param n The number of low coefficients to skip.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_mulhigh(fp_poly_t **res, fp_poly_t *a, fp_poly_t *b, size_t n, fp_field_t *field)
+{
+    size_t len_a = a ? fp_poly_degree(a) + 1 : 0, len_b = b ? fp_poly_degree(b) + 1 : 0;
+    size_t len = len_a + len_b - 1 > n ? len_a + len_b - 1 - n : 1;
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_poly_truncated_operands(&buffer, len_a, len_b, a, b, len, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    uint8_t *high = buffer + len_a + len_b;
+    if (len_a + len_b - 1 > n)
+        fp_poly_dense_mulhigh(high, buffer, len_a, buffer + len_a, len_b, n, field->order);
+    else
+        high[0] = 0;
+    *res = fp_poly_init_array(high, len);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the middle product of two polynoms, i.e., the coefficients of degree n - 1 to 2n - 2 of (a mod x^(2n - 1)) (b mod x^n), divided by x^(n - 1).
+ *
+ * @details This is the transposed multiplication used by the Newton iterations, which costs about one product of length n (see fp_poly_dense_mulmid()).
+ *
+ * @param res The polynom which will store the middle product.
+ * @param a The first polynom.
+ * @param b The second polynom.
+ * @param n The length of the middle product (non zero).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_mulmid(fp_poly_t **res, fp_poly_t *a, fp_poly_t *b, size_t n, fp_field_t *field)
+{
+    if (n == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the precision is zero");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_poly_truncated_operands(&buffer, 2 * n - 1, n, a, b, n, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    uint8_t *middle = buffer + 3 * n - 1;
+    fp_poly_dense_mulmid(middle, buffer, buffer + 2 * n - 1, n, field->order);
+    *res = fp_poly_init_array(middle, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Retrieve the remainder of the division of the multiplication of two polynoms by an irreducible polynom.
+ *
+ * @details When the field holds a prepared modulus, the product is computed on dense arrays and reduced with the Barrett reduction (see fp_poly_modulus_reduce()), so that no quotient is ever built. <br>
+ * Otherwise, the product is divided by the irreducible polynom with fp_poly_div().
+ *
+ * @param res The parameter which will store the remainder of the division.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_mul_fq(fp_poly_t **res, fp_poly_t *p, fp_poly_t *q, fp_field_t *f)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (f->modulus)
+    {
+        size_t len_p = fp_poly_degree(p) + 1, len_q = fp_poly_degree(q) + 1;
+        uint8_t *buffer = (uint8_t *) malloc(2 * (len_p + len_q) + FP_POLY_MODULUS_SCRATCH(f->modulus->degree));
+        if (!buffer)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            return FP_POLY_E_MEMORY;
+        }
+        uint8_t *dense_p = buffer, *dense_q = buffer + len_p, *prod = buffer + len_p + len_q, *scratch = buffer + 2 * (len_p + len_q);
+        fp_poly_to_dense(dense_p, len_p, p, f->order);
+        fp_poly_to_dense(dense_q, len_q, q, f->order);
+        fp_poly_dense_mul(prod, dense_p, len_p, dense_q, len_q, f->order);
+        size_t len_prod = len_p + len_q - 1;
+        if (fp_poly_modulus_reduce(prod, len_prod, scratch, f->modulus, f->order) != FP_POLY_E_SUCCESS)
+        {
+            free(buffer);
+            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_modulus_reduce() failed");
+            return FP_POLY_E_POLYNOM_MANIPULATION;
+        }
+        *res = fp_poly_init_array(prod, len_prod < f->modulus->degree ? len_prod : f->modulus->degree);
+        free(buffer);
+        if (!*res)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            return FP_POLY_E_MEMORY;
+        }
+        return FP_POLY_E_SUCCESS;
+    }
+    fp_poly_t *tmp_res, *tmp_q, *tmp_r;
+    if (fp_poly_mul(&tmp_res, p, q, f) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    if (fp_poly_div(&tmp_q, &tmp_r, tmp_res, f->irreducible_polynom, f) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    if (fp_poly_free(tmp_res) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    if (fp_poly_free(tmp_q) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    *res = tmp_r;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the inverse of an integer modulo the order of a field with the extended Euclidean algorithm.
+ *
+ * @param element The integer.
+ * @param order The order of the field.
+ *
+ * @return The inverse of the integer modulo \p order or 0 if no inverse exists.
+ */
+static uint8_t fp_poly_inv_euclid(uint8_t element, uint8_t order)
+{
+    int16_t r0 = order, r1 = element % order, s0 = 0, s1 = 1;
+    while (r1 != 0)
+    {
+        int16_t q = r0 / r1, tmp = r0 - q * r1;
+        r0 = r1;
+        r1 = tmp;
+        tmp = s0 - q * s1;
+        s0 = s1;
+        s1 = tmp;
+    }
+    if (r0 != 1)
+        return 0;
+    return s0 < 0 ? s0 + order : s0;
+}
+
+/**
+ * @brief Build the table of the inverses of the integers modulo the order of a field.
+ *
+ * @param order The order of the field.
+ *
+ * @return The table of \p order entries (the entry a is the inverse of a, or 0 if a is not invertible), or NULL if the allocation failed.
+ */
+static uint8_t *fp_poly_inverse_table_init(uint8_t order)
+{
+    uint8_t *inverse = (uint8_t *) calloc(order, 1);
+    if (!inverse)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    for (uint16_t a = 1; a < order; a++)
+        if (inverse[a] == 0)
+        {
+            uint8_t b = fp_poly_inv_euclid(a, order);
+            inverse[a] = b;
+            if (b != 0)
+                inverse[b] = a;
+        }
+    return inverse;
+}
+
+/**
+ * @brief Compute the inverse of an integer within a field.
+ *
+ * @details The inverse is read from the table of the field (see @ref fp_field_t), or computed with the extended Euclidean algorithm when the field has no table.
+ * 
+ * @param element The integer.
+ * @param field The field.
+ * 
+ * @return The inverse of the integer within the field or 0 if no inverse is found.
+ */
+uint8_t fp_poly_inv(uint8_t element, fp_field_t *field)
+{
+    if (field->inverse)
+        return field->inverse[element % field->order];
+    return fp_poly_inv_euclid(element, field->order);
+}
+
+/**
+ * @brief Divide two polynoms.
+ * 
+ * @param q The parameter which will store the quotient.
+ * @param r The parameter which will store the remainder.
+ * @param n The dividend.
+ * @param d The divisor.
+ * @param f The field in which the division is performed.
+ * 
+ * @note A field is required since only the multiplication of integer is supported (impossible to multiply an integer by a fraction).
+ * 
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_div(fp_poly_t **q, fp_poly_t **r, fp_poly_t *n, fp_poly_t *d, fp_field_t *f)
+{
+    if ((*r = fp_poly_init_mpz(n->index_coeff, list_copy(n->coeff))) == NULL)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    if ((*q = fp_poly_init()) == NULL)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    mpz_set_ui((*q)->index_coeff, 0x1);
+    if (list_add_beginning((*q)->coeff, 0) != LIST_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_LIST_COEFFICIENT, __FILE__, __func__, __LINE__, "list_add_beginning() failed");
+        return FP_POLY_E_LIST_COEFFICIENT;
+    }
+    fp_poly_t *t;
+    if ((t = fp_poly_init()) == NULL)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    if (list_add_beginning(t->coeff, 0) != LIST_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_LIST_COEFFICIENT, __FILE__, __func__, __LINE__, "list_add_beginning() failed");
+        return FP_POLY_E_LIST_COEFFICIENT;
+    }
+    mpz_t bitwise;
+    mpz_init(bitwise);
+    while (fp_poly_is_zero(*r) == 0 && fp_poly_degree(*r) >= fp_poly_degree(d))
+    {
+        mpz_set_ui(bitwise, 0);
+        mpz_setbit(bitwise, fp_poly_degree(*r) - fp_poly_degree(d));
+        mpz_set(t->index_coeff, bitwise);
+        uint16_t tmp = (uint16_t) fp_poly_inv(d->coeff->tail->coeff, f) * (uint16_t) (*r)->coeff->tail->coeff;
+        tmp = tmp % f->order;
+        t->coeff->tail->coeff = (uint8_t) tmp;
+        fp_poly_t *mem = *q;
+        fp_poly_error_t err;
+        if ((err = fp_poly_add(q, *q, t, f) != FP_POLY_E_SUCCESS))
+        {
+            fp_poly_error(err, __FILE__, __func__, __LINE__, "");
+            return err;
+        }
+        if (fp_poly_free(mem) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
+            return FP_POLY_E_POLYNOM_MANIPULATION;
+        }
+        fp_poly_t *intermediate;
+        if ((err = fp_poly_mul(&intermediate, t, d, f)) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_error(err, __FILE__, __func__, __LINE__, "");
+            return err;
+        }
+        mem = *r;
+        if ((err = fp_poly_sub(r, *r, intermediate, f)) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_error(err, __FILE__, __func__, __LINE__, "");
+            return err;
+        }
+        fp_poly_free(mem);
+        fp_poly_free(intermediate);
+    }
+    fp_poly_free(t);
+    mpz_clear(bitwise);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Structure representing the non zero terms of a sparse polynom, used by the heap algorithms.
+ *
+ * @param len The number of terms.
+ * @param degree The degrees of the terms, by increasing order.
+ * @param coeff The coefficients of the terms.
+ */
+typedef struct fp_poly_terms_t
+{
+    size_t len;
+    size_t *degree;
+    uint8_t *coeff;
+} fp_poly_terms_t;
+
+/**
+ * @brief Structure representing an entry of the heap of the sparse algorithms, i.e., the product of the term i of the first operand by the term j of the second one.
+ *
+ * @param key The key of the entry (the heap is a min-heap on the keys).
+ * @param i The index of the term of the first operand.
+ * @param j The index of the term of the second operand.
+ */
+typedef struct fp_poly_heap_entry_t
+{
+    size_t key;
+    size_t i;
+    size_t j;
+} fp_poly_heap_entry_t;
+
+/**
+ * @brief Read the non zero terms of a polynom.
+ *
+ * @param t The terms (must be uninitialized).
+ * @param p The polynom.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_terms_from_poly(fp_poly_terms_t *t, fp_poly_t *p, uint8_t order)
+{
+    size_t size = p->coeff->size ? p->coeff->size : 1;
+    t->len = 0;
+    t->degree = (size_t *) malloc(size * sizeof(size_t));
+    t->coeff = (uint8_t *) malloc(size);
+    if (!t->degree || !t->coeff)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        free(t->degree);
+        free(t->coeff);
+        return FP_POLY_E_MEMORY;
+    }
+    size_t d = 0;
+    for (list_node_t *node = p->coeff->head; node != NULL; node = node->next, d++)
+    {
+        d = mpz_scan1(p->index_coeff, d);
+        if (node->coeff % order == 0)
+            continue;
+        t->degree[t->len] = d;
+        t->coeff[t->len] = node->coeff % order;
+        t->len++;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Free the terms of a sparse polynom.
+ *
+ * @param t The terms.
+ */
+static void fp_poly_terms_clear(fp_poly_terms_t *t)
+{
+    free(t->degree);
+    free(t->coeff);
+}
+
+/**
+ * @brief Append a term to a sparse polynom.
+ *
+ * @param t The terms.
+ * @param capacity The number of terms which may be stored without reallocation (updated when the arrays grow).
+ * @param degree The degree of the term.
+ * @param coeff The coefficient of the term.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_terms_append(fp_poly_terms_t *t, size_t *capacity, size_t degree, uint8_t coeff)
+{
+    if (t->len == *capacity)
+    {
+        size_t new_capacity = *capacity ? 2 * *capacity : 16;
+        size_t *new_degree = (size_t *) realloc(t->degree, new_capacity * sizeof(size_t));
+        if (new_degree)
+            t->degree = new_degree;
+        uint8_t *new_coeff = (uint8_t *) realloc(t->coeff, new_capacity);
+        if (new_coeff)
+            t->coeff = new_coeff;
+        if (!new_degree || !new_coeff)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            return FP_POLY_E_MEMORY;
+        }
+        *capacity = new_capacity;
+    }
+    t->degree[t->len] = degree;
+    t->coeff[t->len] = coeff;
+    t->len++;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Create a polynom from the terms of a sparse polynom.
+ *
+ * @details The terms may be given by increasing or decreasing degrees. The index of the polynom is allocated once, and each coefficient is appended to its list in constant time.
+ *
+ * @param t The terms.
+ * @param is_increasing A boolean value: 1 if the terms are sorted by increasing degrees, 0 otherwise.
+ *
+ * @return The polynom if the operation was successful or NULL otherwise.
+ */
+static fp_poly_t *fp_poly_terms_to_poly(fp_poly_terms_t *t, uint8_t is_increasing)
+{
+    if (t->len == 0)
+        return fp_poly_init_array((uint8_t[]) {0}, 1);
+    fp_poly_t *res = fp_poly_init();
+    if (!res || !res->coeff)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    mpz_realloc2(res->index_coeff, (is_increasing ? t->degree[t->len - 1] : t->degree[0]) + 1);
+    for (size_t k = 0; k < t->len; k++)
+    {
+        mpz_setbit(res->index_coeff, t->degree[k]);
+        list_error_t err = is_increasing ? list_add_end(res->coeff, t->coeff[k]) : list_add_beginning(res->coeff, t->coeff[k]);
+        if (err != LIST_E_SUCCESS)
+        {
+            fp_poly_error(FP_POLY_E_LIST_COEFFICIENT, __FILE__, __func__, __LINE__, is_increasing ? "list_add_end() failed" : "list_add_beginning() failed");
+            fp_poly_free(res);
+            return NULL;
+        }
+    }
+    return res;
+}
+
+/**
+ * @brief Insert an entry in a min-heap.
+ *
+ * @param heap The heap (its capacity must be larger than its size).
+ * @param size The size of the heap (incremented).
+ * @param entry The entry.
+ */
+static void fp_poly_heap_push(fp_poly_heap_entry_t *heap, size_t *size, fp_poly_heap_entry_t entry)
+{
+    size_t k = (*size)++;
+    while (k > 0 && heap[(k - 1) / 2].key > entry.key)
+    {
+        heap[k] = heap[(k - 1) / 2];
+        k = (k - 1) / 2;
+    }
+    heap[k] = entry;
+}
+
+/**
+ * @brief Remove the entry of smallest key of a non empty min-heap.
+ *
+ * @param heap The heap.
+ * @param size The size of the heap (decremented).
+ *
+ * @return The entry of smallest key.
+ */
+static fp_poly_heap_entry_t fp_poly_heap_pop(fp_poly_heap_entry_t *heap, size_t *size)
+{
+    fp_poly_heap_entry_t res = heap[0], last = heap[--(*size)];
+    size_t k = 0;
+    while (2 * k + 1 < *size)
+    {
+        size_t child = 2 * k + 1;
+        if (child + 1 < *size && heap[child + 1].key < heap[child].key)
+            child++;
+        if (heap[child].key >= last.key)
+            break;
+        heap[k] = heap[child];
+        k = child;
+    }
+    heap[k] = last;
+    return res;
+}
+
+/**
+ * @brief Multiply two sparse polynoms with a heap.
+ *
+ * @details This is the method of Johnson: the products p_i q_j are merged by increasing degrees with a heap holding at most one product per term of \p p. <br>
+ * When (i, j) is popped, (i, j + 1) is pushed, and so is (i + 1, 0) when j = 0. The product of polynoms with t_1 and t_2 terms thus costs O(t_1 t_2 log t_1) operations, and the memory is proportional to t_1 plus the size of the product, whatever the degrees.
+ *
+ * @param res The polynom which will store the product.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_mul_sparse(fp_poly_t **res, fp_poly_t *p, fp_poly_t *q, fp_field_t *field)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    uint8_t order = field->order;
+    fp_poly_terms_t a, b, c = {0, NULL, NULL};
+    if (fp_poly_terms_from_poly(&a, p, order) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    if (fp_poly_terms_from_poly(&b, q, order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_terms_clear(&a);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_error_t err = FP_POLY_E_SUCCESS;
+    fp_poly_heap_entry_t *heap = (fp_poly_heap_entry_t *) malloc((a.len ? a.len : 1) * sizeof(fp_poly_heap_entry_t));
+    if (!heap)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        err = FP_POLY_E_MEMORY;
+    }
+    size_t size = 0, capacity = 0;
+    if (heap && a.len && b.len)
+        fp_poly_heap_push(heap, &size, (fp_poly_heap_entry_t) {a.degree[0] + b.degree[0], 0, 0});
+    while (err == FP_POLY_E_SUCCESS && size > 0)
+    {
+        // merge all the products of the smallest degree
+        size_t degree = heap[0].key;
+        uint32_t acc = 0;
+        while (size > 0 && heap[0].key == degree)
+        {
+            fp_poly_heap_entry_t e = fp_poly_heap_pop(heap, &size);
+            acc = (acc + (uint16_t) a.coeff[e.i] * b.coeff[e.j]) % order;
+            if (e.j == 0 && e.i + 1 < a.len)
+                fp_poly_heap_push(heap, &size, (fp_poly_heap_entry_t) {a.degree[e.i + 1] + b.degree[0], e.i + 1, 0});
+            if (e.j + 1 < b.len)
+                fp_poly_heap_push(heap, &size, (fp_poly_heap_entry_t) {a.degree[e.i] + b.degree[e.j + 1], e.i, e.j + 1});
+        }
+        if (acc != 0)
+            err = fp_poly_terms_append(&c, &capacity, degree, acc);
+    }
+    if (err == FP_POLY_E_SUCCESS && (*res = fp_poly_terms_to_poly(&c, 1)) == NULL)
+        err = FP_POLY_E_MEMORY;
+    free(heap);
+    fp_poly_terms_clear(&a);
+    fp_poly_terms_clear(&b);
+    fp_poly_terms_clear(&c);
+    return err;
+}
+
+/**
+ * @brief Divide two sparse polynoms with a heap.
+ *
+ * @details This is the method of Monagan and Pearce: the terms of the dividend minus the products q_i d_j (j > 0) are merged by decreasing degrees with a heap holding at most one product per term of the quotient. <br>
+ * Each merged term of degree at least the degree of \p d gives a new term of the quotient, and the other ones are the terms of the remainder. The quotient and the remainder are thus produced in decreasing degree order, with O(t_n + t_q t_d log t_q) operations and a memory proportional to the size of the output.
+ *
+ * @param q The polynom which will store the quotient.
+ * @param r The polynom which will store the remainder.
+ * @param n The dividend.
+ * @param d The divisor (non zero).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_div_sparse(fp_poly_t **q, fp_poly_t **r, fp_poly_t *n, fp_poly_t *d, fp_field_t *field)
+{
+    if (!n || !d)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    uint8_t order = field->order;
+    fp_poly_terms_t a, b, quotient = {0, NULL, NULL}, remainder = {0, NULL, NULL};
+    if (fp_poly_terms_from_poly(&a, n, order) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    if (fp_poly_terms_from_poly(&b, d, order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_terms_clear(&a);
+        return FP_POLY_E_MEMORY;
+    }
+    if (b.len == 0)
+    {
+        fp_poly_terms_clear(&a);
+        fp_poly_terms_clear(&b);
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "division by zero");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    // the terms are read by decreasing degrees, and the key of a product of degree k is SIZE_MAX - k
+    size_t lead = b.len - 1, degree_b = b.degree[lead], capacity_q = 0, capacity_r = 0, size = 0, capacity_heap = 16;
+    uint8_t lc_inv = fp_poly_inv(b.coeff[lead], field);
+    fp_poly_error_t err = FP_POLY_E_SUCCESS;
+    fp_poly_heap_entry_t *heap = (fp_poly_heap_entry_t *) malloc(capacity_heap * sizeof(fp_poly_heap_entry_t));
+    if (!heap)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        err = FP_POLY_E_MEMORY;
+    }
+    size_t k = a.len;
+    while (err == FP_POLY_E_SUCCESS && (k > 0 || size > 0))
+    {
+        size_t degree = k > 0 ? a.degree[k - 1] : 0;
+        if (size > 0 && SIZE_MAX - heap[0].key > degree)
+            degree = SIZE_MAX - heap[0].key;
+        uint32_t acc = 0;
+        if (k > 0 && a.degree[k - 1] == degree)
+            acc = a.coeff[--k];
+        while (size > 0 && heap[0].key == SIZE_MAX - degree)
+        {
+            fp_poly_heap_entry_t e = fp_poly_heap_pop(heap, &size);
+            acc = (acc + order - (uint16_t) quotient.coeff[e.i] * b.coeff[e.j] % order) % order;
+            if (e.j > 0)
+                fp_poly_heap_push(heap, &size, (fp_poly_heap_entry_t) {SIZE_MAX - (quotient.degree[e.i] + b.degree[e.j - 1]), e.i, e.j - 1});
+        }
+        if (acc == 0)
+            continue;
+        if (degree < degree_b)
+        {
+            err = fp_poly_terms_append(&remainder, &capacity_r, degree, acc);
+            continue;
+        }
+        err = fp_poly_terms_append(&quotient, &capacity_q, degree - degree_b, (uint16_t) acc * lc_inv % order);
+        if (err != FP_POLY_E_SUCCESS || lead == 0)
+            continue;
+        if (size == capacity_heap)
+        {
+            fp_poly_heap_entry_t *new_heap = (fp_poly_heap_entry_t *) realloc(heap, 2 * capacity_heap * sizeof(fp_poly_heap_entry_t));
+            if (!new_heap)
+            {
+                fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+                err = FP_POLY_E_MEMORY;
+                continue;
+            }
+            heap = new_heap;
+            capacity_heap *= 2;
+        }
+        size_t i = quotient.len - 1;
+        fp_poly_heap_push(heap, &size, (fp_poly_heap_entry_t) {SIZE_MAX - (quotient.degree[i] + b.degree[lead - 1]), i, lead - 1});
+    }
+    if (err == FP_POLY_E_SUCCESS && (*q = fp_poly_terms_to_poly(&quotient, 0)) == NULL)
+        err = FP_POLY_E_MEMORY;
+    if (err == FP_POLY_E_SUCCESS && (*r = fp_poly_terms_to_poly(&remainder, 0)) == NULL)
+    {
+        fp_poly_free(*q);
+        err = FP_POLY_E_MEMORY;
+    }
+    free(heap);
+    fp_poly_terms_clear(&a);
+    fp_poly_terms_clear(&b);
+    fp_poly_terms_clear(&quotient);
+    fp_poly_terms_clear(&remainder);
+    return err;
+}
+
+/**
+ * @brief Structure representing a dense polynom, used by the fast algorithms on polynoms.
+ *
+ * @details The coefficient of degree i is stored at index i of the array. A normalised dense polynom has a non zero leading coefficient, and the zero polynom has a length of 0.
+ *
+ * @param len The number of coefficients.
+ * @param coeff The coefficients.
+ */
+typedef struct fp_poly_dense_t
+{
+    size_t len;
+    uint8_t *coeff;
+} fp_poly_dense_t;
+
+/**
+ * @brief Structure representing a 2x2 matrix of dense polynoms, used by the half-GCD algorithm.
+ *
+ * @param m The coefficients of the matrix, in the order m_00, m_01, m_10, m_11.
+ */
+typedef struct fp_poly_matrix_t
+{
+    fp_poly_dense_t m[4];
+} fp_poly_matrix_t;
+
+/**
+ * @brief Initialize a dense polynom whose coefficients are all zero.
+ *
+ * @param d The dense polynom.
+ * @param len The number of coefficients.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_init(fp_poly_dense_t *d, size_t len)
+{
+    d->len = len;
+    d->coeff = (uint8_t *) calloc(len ? len : 1, 1);
+    if (!d->coeff)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Free the coefficients of a dense polynom.
+ *
+ * @param d The dense polynom.
+ */
+static void fp_poly_dense_clear(fp_poly_dense_t *d)
+{
+    free(d->coeff);
+    d->coeff = NULL;
+    d->len = 0;
+}
+
+/**
+ * @brief Remove the leading zero coefficients of a dense polynom.
+ *
+ * @param d The dense polynom.
+ */
+static void fp_poly_dense_normalise(fp_poly_dense_t *d)
+{
+    while (d->len > 0 && d->coeff[d->len - 1] == 0)
+        d->len--;
+}
+
+/**
+ * @brief Initialize a normalised dense polynom from a polynom.
+ *
+ * @param d The dense polynom.
+ * @param p The polynom.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_from_poly(fp_poly_dense_t *d, fp_poly_t *p, uint8_t order)
+{
+    if (fp_poly_dense_init(d, fp_poly_degree(p) + 1) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    fp_poly_to_dense(d->coeff, d->len, p, order);
+    fp_poly_dense_normalise(d);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Create a polynom from a dense polynom.
+ *
+ * @param d The dense polynom.
+ *
+ * @return The polynom if the operation was successful or NULL otherwise.
+ */
+static fp_poly_t *fp_poly_dense_to_poly(fp_poly_dense_t *d)
+{
+    if (d->len == 0)
+        return fp_poly_init_array((uint8_t[]) {0}, 1);
+    return fp_poly_init_array(d->coeff, d->len);
+}
+
+/**
+ * @brief Copy a dense polynom divided by x^k (the coefficients of degree lower than k are dropped).
+ *
+ * @param res The dense polynom which will store the result (must be uninitialized).
+ * @param a The dense polynom.
+ * @param k The shift.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_shift(fp_poly_dense_t *res, fp_poly_dense_t *a, size_t k)
+{
+    size_t len = a->len > k ? a->len - k : 0;
+    if (fp_poly_dense_init(res, len) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    if (len)
+        memcpy(res->coeff, a->coeff + k, len);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Multiply two dense polynoms.
+ *
+ * @param res The dense polynom which will store the product (must be uninitialized).
+ * @param a The first dense polynom.
+ * @param b The second dense polynom.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_product(fp_poly_dense_t *res, fp_poly_dense_t *a, fp_poly_dense_t *b, uint8_t order)
+{
+    if (a->len == 0 || b->len == 0)
+        return fp_poly_dense_init(res, 0);
+    if (fp_poly_dense_init(res, a->len + b->len - 1) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    fp_poly_dense_mul(res->coeff, a->coeff, a->len, b->coeff, b->len, order);
+    fp_poly_dense_normalise(res);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute a * b + c * d (or a * b - c * d) on dense polynoms.
+ *
+ * @param res The dense polynom which will store the result (must be uninitialized).
+ * @param a The first factor of the first product.
+ * @param b The second factor of the first product.
+ * @param c The first factor of the second product.
+ * @param d The second factor of the second product.
+ * @param is_addition A boolean value: 1 to add the two products or 0 to substract the second one from the first one.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_mul_add(fp_poly_dense_t *res, fp_poly_dense_t *a, fp_poly_dense_t *b, fp_poly_dense_t *c, fp_poly_dense_t *d, uint8_t is_addition, uint8_t order)
+{
+    fp_poly_dense_t ab = {0, NULL}, cd = {0, NULL};
+    if (fp_poly_dense_product(&ab, a, b, order) != FP_POLY_E_SUCCESS || fp_poly_dense_product(&cd, c, d, order) != FP_POLY_E_SUCCESS
+        || fp_poly_dense_init(res, ab.len > cd.len ? ab.len : cd.len) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&ab);
+        fp_poly_dense_clear(&cd);
+        return FP_POLY_E_MEMORY;
+    }
+    for (size_t i = 0; i < res->len; i++)
+    {
+        uint8_t x = i < ab.len ? ab.coeff[i] : 0;
+        uint8_t y = i < cd.len ? cd.coeff[i] : 0;
+        res->coeff[i] = is_addition ? (x + y) % order : (x + order - y) % order;
+    }
+    fp_poly_dense_normalise(res);
+    fp_poly_dense_clear(&ab);
+    fp_poly_dense_clear(&cd);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Divide two dense polynoms.
+ *
+ * @param q The dense polynom which will store the quotient (must be uninitialized).
+ * @param r The dense polynom which will store the remainder (must be uninitialized).
+ * @param a The dividend.
+ * @param b The divisor (normalised and non zero).
+ * @param field The field in which the division is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_divrem(fp_poly_dense_t *q, fp_poly_dense_t *r, fp_poly_dense_t *a, fp_poly_dense_t *b, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    if (fp_poly_dense_init(r, a->len) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    if (a->len)
+        memcpy(r->coeff, a->coeff, a->len);
+    if (fp_poly_dense_init(q, a->len < b->len ? 0 : a->len - b->len + 1) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(r);
+        return FP_POLY_E_MEMORY;
+    }
+    if (a->len < b->len)
+        return FP_POLY_E_SUCCESS;
+    uint8_t lc_inv = fp_poly_inv(b->coeff[b->len - 1], field);
+    for (size_t i = q->len; i > 0; i--)
+    {
+        uint8_t c = (uint16_t) r->coeff[i - 1 + b->len - 1] * lc_inv % order;
+        q->coeff[i - 1] = c;
+        if (c == 0)
+            continue;
+        uint8_t minus_c = order - c;
+        for (size_t j = 0; j < b->len; j++)
+            r->coeff[i - 1 + j] = (r->coeff[i - 1 + j] + (uint32_t) minus_c * b->coeff[j]) % order;
+    }
+    r->len = b->len - 1;
+    fp_poly_dense_normalise(r);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Initialize the identity matrix.
+ *
+ * @param m The matrix.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_matrix_init_identity(fp_poly_matrix_t *m)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        if (fp_poly_dense_init(&m->m[i], (i == 0 || i == 3) ? 1 : 0) != FP_POLY_E_SUCCESS)
+        {
+            while (i > 0)
+                fp_poly_dense_clear(&m->m[--i]);
+            return FP_POLY_E_MEMORY;
+        }
+        m->m[i].coeff[0] = (i == 0 || i == 3) ? 1 : 0;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Free the coefficients of a matrix.
+ *
+ * @param m The matrix.
+ */
+static void fp_poly_matrix_clear(fp_poly_matrix_t *m)
+{
+    for (size_t i = 0; i < 4; i++)
+        fp_poly_dense_clear(&m->m[i]);
+}
+
+/**
+ * @brief Multiply two matrices: left = left * right, the right matrix is left untouched.
+ *
+ * @param left The left matrix (updated in place).
+ * @param right The right matrix.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_matrix_mul(fp_poly_matrix_t *left, fp_poly_matrix_t *right, uint8_t order)
+{
+    fp_poly_matrix_t res;
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 2; j++)
+            if (fp_poly_dense_mul_add(&res.m[2 * i + j], &left->m[2 * i], &right->m[j], &left->m[2 * i + 1], &right->m[2 + j], 1, order) != FP_POLY_E_SUCCESS)
+            {
+                for (size_t k = 0; k < 2 * i + j; k++)
+                    fp_poly_dense_clear(&res.m[k]);
+                return FP_POLY_E_MEMORY;
+            }
+    fp_poly_matrix_clear(left);
+    *left = res;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Apply a matrix to a pair of dense polynoms: (a, b) = m * (a, b).
+ *
+ * @param m The matrix.
+ * @param a The first dense polynom (updated in place).
+ * @param b The second dense polynom (updated in place).
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_matrix_apply(fp_poly_matrix_t *m, fp_poly_dense_t *a, fp_poly_dense_t *b, uint8_t order)
+{
+    fp_poly_dense_t new_a, new_b;
+    if (fp_poly_dense_mul_add(&new_a, &m->m[0], a, &m->m[1], b, 1, order) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    if (fp_poly_dense_mul_add(&new_b, &m->m[2], a, &m->m[3], b, 1, order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&new_a);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_dense_clear(a);
+    fp_poly_dense_clear(b);
+    *a = new_a;
+    *b = new_b;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Perform one step of the Euclidean algorithm: (a, b) = (b, a mod b) and m = [[0, 1], [1, -q]] * m.
+ *
+ * @param m The matrix which accumulates the quotients (may be NULL).
+ * @param a The first dense polynom (updated in place).
+ * @param b The second dense polynom, non zero (updated in place).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_euclid_step(fp_poly_matrix_t *m, fp_poly_dense_t *a, fp_poly_dense_t *b, fp_field_t *field)
+{
+    fp_poly_dense_t q, r;
+    if (fp_poly_dense_divrem(&q, &r, a, b, field) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    fp_poly_dense_clear(a);
+    *a = *b;
+    *b = r;
+    if (m)
+    {
+        fp_poly_dense_t one = {1, (uint8_t[]) {1}};
+        for (size_t j = 0; j < 2; j++)
+        {
+            fp_poly_dense_t new_row;
+            if (fp_poly_dense_mul_add(&new_row, &one, &m->m[j], &q, &m->m[2 + j], 0, field->order) != FP_POLY_E_SUCCESS)
+            {
+                fp_poly_dense_clear(&q);
+                return FP_POLY_E_MEMORY;
+            }
+            fp_poly_dense_clear(&m->m[j]);
+            m->m[j] = m->m[2 + j];
+            m->m[2 + j] = new_row;
+        }
+    }
+    fp_poly_dense_clear(&q);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the half-GCD matrix of two dense polynoms.
+ *
+ * @details Let n be the length of \\p a and k = n / 2. The returned matrix m is the product of the Euclidean steps of (a, b) that are performed as long as the length of the second remainder is greater than k. <br>
+ * The algorithm recurses on the high halves of the polynoms (divided by x^k), performs one Euclidean step, and recurses again on the high halves of the new remainders, so that its cost is O(M(n) log n). <br>
+ * Below @ref FP_POLY_HGCD_THRESHOLD coefficients, the Euclidean steps are performed one by one.
+ *
+ * @param m The matrix which will store the result (must be uninitialized, left unallocated on failure).
+ * @param a The first dense polynom (normalised).
+ * @param b The second dense polynom (normalised, shorter than \\p a).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_hgcd(fp_poly_matrix_t *m, fp_poly_dense_t *a, fp_poly_dense_t *b, fp_field_t *field)
+{
+    size_t k = a->len / 2;
+    if (fp_poly_matrix_init_identity(m) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    if (b->len <= k)
+        return FP_POLY_E_SUCCESS;
+    fp_poly_dense_t c = {0, NULL}, d = {0, NULL};
+    if (a->len < FP_POLY_HGCD_THRESHOLD)
+    {
+        fp_poly_error_t err = FP_POLY_E_SUCCESS;
+        if (fp_poly_dense_shift(&c, a, 0) != FP_POLY_E_SUCCESS || fp_poly_dense_shift(&d, b, 0) != FP_POLY_E_SUCCESS)
+            err = FP_POLY_E_MEMORY;
+        while (err == FP_POLY_E_SUCCESS && d.len > k)
+            err = fp_poly_euclid_step(m, &c, &d, field);
+        fp_poly_dense_clear(&c);
+        fp_poly_dense_clear(&d);
+        if (err != FP_POLY_E_SUCCESS)
+            fp_poly_matrix_clear(m);
+        return err;
+    }
+    fp_poly_matrix_t m1;
+    if (fp_poly_dense_shift(&c, a, k) != FP_POLY_E_SUCCESS || fp_poly_dense_shift(&d, b, k) != FP_POLY_E_SUCCESS
+        || fp_poly_hgcd(&m1, &c, &d, field) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&c);
+        fp_poly_dense_clear(&d);
+        fp_poly_matrix_clear(m);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_dense_clear(&c);
+    fp_poly_dense_clear(&d);
+    fp_poly_matrix_clear(m);
+    *m = m1;
+    if (fp_poly_dense_shift(&c, a, 0) != FP_POLY_E_SUCCESS || fp_poly_dense_shift(&d, b, 0) != FP_POLY_E_SUCCESS
+        || fp_poly_matrix_apply(m, &c, &d, field->order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&c);
+        fp_poly_dense_clear(&d);
+        fp_poly_matrix_clear(m);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_error_t err = FP_POLY_E_SUCCESS;
+    if (d.len > k)
+        err = fp_poly_euclid_step(m, &c, &d, field);
+    if (err == FP_POLY_E_SUCCESS && d.len > k)
+    {
+        size_t j = 2 * k - (c.len - 1);
+        fp_poly_dense_t high_c = {0, NULL}, high_d = {0, NULL};
+        fp_poly_matrix_t m2;
+        err = FP_POLY_E_MEMORY;
+        if (fp_poly_dense_shift(&high_c, &c, j) == FP_POLY_E_SUCCESS && fp_poly_dense_shift(&high_d, &d, j) == FP_POLY_E_SUCCESS
+            && fp_poly_hgcd(&m2, &high_c, &high_d, field) == FP_POLY_E_SUCCESS)
+        {
+            if (fp_poly_matrix_mul(&m2, m, field->order) == FP_POLY_E_SUCCESS)
+            {
+                fp_poly_matrix_clear(m);
+                *m = m2;
+                err = FP_POLY_E_SUCCESS;
+            }
+            else
+                fp_poly_matrix_clear(&m2);
+        }
+        fp_poly_dense_clear(&high_c);
+        fp_poly_dense_clear(&high_d);
+    }
+    fp_poly_dense_clear(&c);
+    fp_poly_dense_clear(&d);
+    if (err != FP_POLY_E_SUCCESS)
+        fp_poly_matrix_clear(m);
+    return err;
+}
+
+/**
+ * @brief Compute the monic greatest common divisor of two dense polynoms with the Euclidean algorithm, without any allocation.
+ *
+ * @details At each step, the divisor is made monic and the leading terms of the dividend are eliminated in place, so that the dividend buffer ends up holding the remainder. The two buffers are then swapped. <br>
+ * No quotient is computed: the cost of a step is only the coefficient arithmetic.
+ *
+ * @param a The first dense polynom (normalised), which will store the greatest common divisor.
+ * @param b The second dense polynom (normalised), which will be zero afterwards.
+ * @param field The field in which the operation is performed.
+ */
+static void fp_poly_dense_gcd_euclid(fp_poly_dense_t *a, fp_poly_dense_t *b, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    uint8_t *r0 = a->coeff, *r1 = b->coeff;
+    size_t len_r0 = a->len, len_r1 = b->len;
+    while (len_r1 > 0)
+    {
+        uint8_t lc_inv = fp_poly_inv(r1[len_r1 - 1], field);
+        if (lc_inv != 1)
+            for (size_t j = 0; j < len_r1; j++)
+                r1[j] = (uint16_t) r1[j] * lc_inv % order;
+        for (size_t i = len_r0; i >= len_r1; i--)
+        {
+            uint8_t c = r0[i - 1];
+            if (c == 0)
+                continue;
+            uint8_t *row = r0 + i - len_r1;
+            if (order == 2)
+                for (size_t j = 0; j < len_r1; j++)
+                    row[j] ^= r1[j];
+            else
+            {
+                uint8_t minus_c = order - c;
+                for (size_t j = 0; j < len_r1; j++)
+                    row[j] = (row[j] + (uint16_t) minus_c * r1[j]) % order;
+            }
+        }
+        if (len_r0 > len_r1 - 1)
+            len_r0 = len_r1 - 1;
+        while (len_r0 > 0 && r0[len_r0 - 1] == 0)
+            len_r0--;
+        uint8_t *tmp = r0;
+        r0 = r1;
+        r1 = tmp;
+        size_t tmp_len = len_r0;
+        len_r0 = len_r1;
+        len_r1 = tmp_len;
+    }
+    a->coeff = r0;
+    a->len = len_r0;
+    b->coeff = r1;
+    b->len = 0;
+}
+
+/**
+ * @brief Compute the monic greatest common divisor of two dense polynoms, and optionally the Bézout coefficients.
+ *
+ * @details While the remainders are longer than @ref FP_POLY_HGCD_THRESHOLD, the half-GCD matrix is applied to jump over half of the Euclidean steps at once, followed by a single Euclidean step. <br>
+ * The remaining steps are performed by the Euclidean algorithm, in place with fp_poly_dense_gcd_euclid() when the Bézout coefficients are not requested. <br>
+ * Since the in place algorithm is much cheaper than the half-GCD basecase, it takes over as soon as the remainders are shorter than @ref FP_POLY_GCD_THRESHOLD (@ref FP_POLY_GCD_F2_THRESHOLD over F_2). <br>
+ * The Bézout coefficients are the first row of the product of all the Euclidean steps, so they are the same as the ones of the extended Euclidean algorithm.
+ *
+ * @param g The dense polynom which will store the greatest common divisor (must be uninitialized).
+ * @param u The dense polynom which will store the first Bézout coefficient (must be uninitialized, may be NULL).
+ * @param v The dense polynom which will store the second Bézout coefficient (must be uninitialized, may be NULL).
+ * @param a The first dense polynom (normalised).
+ * @param b The second dense polynom (normalised).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_gcd(fp_poly_dense_t *g, fp_poly_dense_t *u, fp_poly_dense_t *v, fp_poly_dense_t *a, fp_poly_dense_t *b, fp_field_t *field)
+{
+    uint8_t is_swapped = a->len < b->len;
+    fp_poly_dense_t c = {0, NULL}, d = {0, NULL};
+    if (fp_poly_dense_shift(&c, is_swapped ? b : a, 0) != FP_POLY_E_SUCCESS || fp_poly_dense_shift(&d, is_swapped ? a : b, 0) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&c);
+        fp_poly_dense_clear(&d);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_matrix_t total, *track = NULL;
+    if (u && v)
+    {
+        if (fp_poly_matrix_init_identity(&total) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_dense_clear(&c);
+            fp_poly_dense_clear(&d);
+            return FP_POLY_E_MEMORY;
+        }
+        track = &total;
+    }
+    fp_poly_error_t err = FP_POLY_E_SUCCESS;
+    while (err == FP_POLY_E_SUCCESS && d.len > 0)
+    {
+        if (!track && d.len < (field->order == 2 ? FP_POLY_GCD_F2_THRESHOLD : FP_POLY_GCD_THRESHOLD))
+        {
+            fp_poly_dense_gcd_euclid(&c, &d, field);
+            break;
+        }
+        if (d.len >= FP_POLY_HGCD_THRESHOLD && c.len > d.len)
+        {
+            fp_poly_matrix_t m;
+            if (fp_poly_hgcd(&m, &c, &d, field) != FP_POLY_E_SUCCESS)
+            {
+                err = FP_POLY_E_MEMORY;
+                break;
+            }
+            if (fp_poly_matrix_apply(&m, &c, &d, field->order) != FP_POLY_E_SUCCESS
+                || (track && fp_poly_matrix_mul(&m, track, field->order) != FP_POLY_E_SUCCESS))
+            {
+                fp_poly_matrix_clear(&m);
+                err = FP_POLY_E_MEMORY;
+                break;
+            }
+            if (track)
+            {
+                fp_poly_matrix_clear(track);
+                *track = m;
+            }
+            else
+                fp_poly_matrix_clear(&m);
+            if (d.len == 0)
+                break;
+        }
+        err = fp_poly_euclid_step(track, &c, &d, field);
+    }
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&c);
+        fp_poly_dense_clear(&d);
+        if (track)
+            fp_poly_matrix_clear(track);
+        return err;
+    }
+    fp_poly_dense_clear(&d);
+    uint8_t lc_inv = c.len ? fp_poly_inv(c.coeff[c.len - 1], field) : 1;
+    for (size_t i = 0; i < c.len; i++)
+        c.coeff[i] = (uint16_t) c.coeff[i] * lc_inv % field->order;
+    *g = c;
+    if (track)
+    {
+        *u = total.m[is_swapped ? 1 : 0];
+        *v = total.m[is_swapped ? 0 : 1];
+        for (size_t i = 0; i < u->len; i++)
+            u->coeff[i] = (uint16_t) u->coeff[i] * lc_inv % field->order;
+        for (size_t i = 0; i < v->len; i++)
+            v->coeff[i] = (uint16_t) v->coeff[i] * lc_inv % field->order;
+        fp_poly_dense_clear(&total.m[2]);
+        fp_poly_dense_clear(&total.m[3]);
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the greatest common divisor of two polynoms.
+ *
+ * @details The greatest common divisor is computed on dense polynoms by fp_poly_dense_gcd(), i.e., with the half-GCD algorithm for long polynoms and the Euclidean algorithm otherwise. <br>
+ * The result is monic (or zero if both polynoms are zero).
+ *
+ * @param res The polynom which will store the greatest common divisor.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_gcd(fp_poly_t **res, fp_poly_t *p, fp_poly_t *q, fp_field_t *f)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_poly_dense_t a = {0, NULL}, b = {0, NULL}, g;
+    if (fp_poly_dense_from_poly(&a, p, f->order) != FP_POLY_E_SUCCESS || fp_poly_dense_from_poly(&b, q, f->order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&a);
+        fp_poly_dense_clear(&b);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    if (fp_poly_dense_gcd(&g, NULL, NULL, &a, &b, f) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&a);
+        fp_poly_dense_clear(&b);
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_dense_gcd() failed");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    *res = fp_poly_dense_to_poly(&g);
+    fp_poly_dense_clear(&a);
+    fp_poly_dense_clear(&b);
+    fp_poly_dense_clear(&g);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the extended greatest common divisor of two polynoms.
+ *
+ * @details The computation is performed by fp_poly_dense_gcd(). The greatest common divisor is monic and the Bézout coefficients are the ones of the extended Euclidean algorithm, scaled accordingly.
+ *
+ * @param res The polynom which will store the greatest common divisor.
+ * @param u The first Bézout coefficient.
+ * @param v The second Bézout coefficient.
+ * @param p The first polynom.
+ * @param q The second polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_gcd_extended(fp_poly_t **res, fp_poly_t **u, fp_poly_t **v, fp_poly_t *p, fp_poly_t *q, fp_field_t *f)
+{
+    if (!p || !q)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_poly_dense_t a = {0, NULL}, b = {0, NULL}, g, dense_u, dense_v;
+    if (fp_poly_dense_from_poly(&a, p, f->order) != FP_POLY_E_SUCCESS || fp_poly_dense_from_poly(&b, q, f->order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&a);
+        fp_poly_dense_clear(&b);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    if (fp_poly_dense_gcd(&g, &dense_u, &dense_v, &a, &b, f) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_dense_clear(&a);
+        fp_poly_dense_clear(&b);
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_dense_gcd() failed");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    *res = fp_poly_dense_to_poly(&g);
+    *u = fp_poly_dense_to_poly(&dense_u);
+    *v = fp_poly_dense_to_poly(&dense_v);
+    fp_poly_dense_clear(&a);
+    fp_poly_dense_clear(&b);
+    fp_poly_dense_clear(&g);
+    fp_poly_dense_clear(&dense_u);
+    fp_poly_dense_clear(&dense_v);
+    if (!*res || !*u || !*v)
+    {
+        if (*res)
+            fp_poly_free(*res);
+        if (*u)
+            fp_poly_free(*u);
+        if (*v)
+            fp_poly_free(*v);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the inverse of a dense polynom modulo the prepared modulus of a field.
+ *
+ * @details The extended Euclidean algorithm is run on (f, a) while tracking only the cofactor s of \\p a, i.e., s * a = r modulo f for each remainder r. <br>
+ * As in fp_poly_dense_gcd_euclid(), the divisor is made monic and the leading terms of the dividend are eliminated in place, each elimination being mirrored on the cofactors. <br>
+ * All the buffers come from the scratch buffer of the caller, so nothing is allocated.
+ *
+ * @param res The dense array which will store the inverse (n coefficients, where n is the degree of the modulus).
+ * @param a The dense polynom to invert (n coefficients).
+ * @param scratch A scratch buffer of @ref FP_POLY_MODULUS_SCRATCH(n) coefficients, owned by the caller.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_modulus_invmod(uint8_t *res, const uint8_t *a, uint8_t *scratch, fp_field_t *field)
+{
+    if (!res || !a || !scratch)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_modulus_t *modulus = field->modulus;
+    if (!modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    uint8_t order = field->order;
+    size_t n = modulus->degree;
+    uint8_t *r0 = scratch, *r1 = r0 + n + 1, *s0 = r1 + n + 1, *s1 = s0 + n + 1;
+    memcpy(r0, modulus->coeff, n + 1);
+    memcpy(r1, a, n);
+    memset(s0, 0, n + 1);
+    memset(s1, 0, n + 1);
+    s1[0] = 1;
+    size_t len_r0 = n + 1, len_r1 = n, len_s0 = 0, len_s1 = 1;
+    while (len_r1 > 0 && r1[len_r1 - 1] == 0)
+        len_r1--;
+    while (len_r1 > 1)
+    {
+        uint8_t lc_inv = fp_poly_inv(r1[len_r1 - 1], field);
+        if (lc_inv == 0)
+        {
+            fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the leading coefficient is not invertible");
+            return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+        }
+        if (lc_inv != 1)
+        {
+            for (size_t j = 0; j < len_r1; j++)
+                r1[j] = (uint16_t) r1[j] * lc_inv % order;
+            for (size_t j = 0; j < len_s1; j++)
+                s1[j] = (uint16_t) s1[j] * lc_inv % order;
+        }
+        for (size_t i = len_r0; i >= len_r1; i--)
+        {
+            uint8_t c = r0[i - 1];
+            if (c == 0)
+                continue;
+            size_t shift = i - len_r1;
+            uint8_t minus_c = order - c;
+            for (size_t j = 0; j < len_r1; j++)
+                r0[shift + j] = (r0[shift + j] + (uint16_t) minus_c * r1[j]) % order;
+            for (size_t j = 0; j < len_s1; j++)
+                s0[shift + j] = (s0[shift + j] + (uint16_t) minus_c * s1[j]) % order;
+            if (shift + len_s1 > len_s0)
+                len_s0 = shift + len_s1;
+        }
+        len_r0 = len_r1 - 1;
+        while (len_r0 > 0 && r0[len_r0 - 1] == 0)
+            len_r0--;
+        while (len_s0 > 0 && s0[len_s0 - 1] == 0)
+            len_s0--;
+        uint8_t *tmp = r0;
+        r0 = r1;
+        r1 = tmp;
+        tmp = s0;
+        s0 = s1;
+        s1 = tmp;
+        size_t tmp_len = len_r0;
+        len_r0 = len_r1;
+        len_r1 = tmp_len;
+        tmp_len = len_s0;
+        len_s0 = len_s1;
+        len_s1 = tmp_len;
+    }
+    if (len_r1 == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the polynom is not invertible modulo the irreducible polynom");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    // r1 is a non zero constant c and s1 * a = c modulo f
+    uint8_t c_inv = fp_poly_inv(r1[0], field);
+    memset(res, 0, n);
+    for (size_t j = 0; j < len_s1 && j < n; j++)
+        res[j] = (uint16_t) s1[j] * c_inv % order;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the inverse of a polynom within a Galois field, i.e., modulo its irreducible polynom.
+ *
+ * @details The polynom is reduced by the prepared modulus of the field and inverted by fp_poly_modulus_invmod(). <br>
+ * A division in the Galois field is then a multiplication by this inverse (see fp_poly_mul_fq()).
+ *
+ * @param res The polynom which will store the inverse.
+ * @param a The polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_invmod(fp_poly_t **res, fp_poly_t *a, fp_field_t *f)
+{
+    if (!a)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!f->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = f->modulus->degree, len_a = fp_poly_degree(a) + 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_a + 2 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *dense_a = buffer, *reduced = buffer + len_a, *inverse = buffer + len_a + n, *scratch = buffer + len_a + 2 * n;
+    fp_poly_to_dense(dense_a, len_a, a, f->order);
+    fp_poly_modulus_reduce(dense_a, len_a, scratch, f->modulus, f->order);
+    memset(reduced, 0, n);
+    memcpy(reduced, dense_a, len_a < n ? len_a : n);
+    fp_poly_error_t err = fp_poly_modulus_invmod(inverse, reduced, scratch, f);
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    *res = fp_poly_init_array(inverse, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the power of a dense polynom modulo the prepared modulus of a field.
+ *
+ * @details The left-to-right sliding window method is used: the odd powers base, base^3, ..., base^(2^k - 1) are computed once, then the bits of the exponent are scanned from the most significant one. <br>
+ * A run of zero bits costs one squaring per bit, and a window of at most k bits ending with a one costs its squarings plus a single multiplication by a precomputed power. <br>
+ * Squarings use the dedicated kernel (see fp_poly_dense_sqr()), and each product is reduced with fp_poly_modulus_reduce(). <br>
+ * A negative exponent raises the inverse of the base (see fp_poly_modulus_invmod()).
+ *
+ * @param res The dense array which will store the power (n coefficients, where n is the degree of the modulus).
+ * @param base The dense polynom (n coefficients).
+ * @param exponent The exponent.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_modulus_powmod(uint8_t *res, const uint8_t *base, mpz_t exponent, fp_field_t *field)
+{
+    if (!res || !base)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_modulus_t *modulus = field->modulus;
+    if (!modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    uint8_t order = field->order;
+    size_t n = modulus->degree;
+    size_t bits = mpz_sizeinbase(exponent, 2);
+    size_t k = bits <= 8 ? 1 : bits <= 24 ? 2 : bits <= 80 ? 3 : bits <= 240 ? 4 : bits <= 672 ? 5 : 6;
+    size_t nb_powers = (size_t) 1 << (k - 1);
+    uint8_t *buffer = (uint8_t *) malloc(nb_powers * n + 2 * n - 1 + FP_POLY_MODULUS_SCRATCH(n));
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *powers = buffer, *prod = buffer + nb_powers * n, *scratch = prod + 2 * n - 1;
+    if (mpz_sgn(exponent) < 0)
+    {
+        fp_poly_error_t err = fp_poly_modulus_invmod(powers, base, scratch, field);
+        if (err != FP_POLY_E_SUCCESS)
+        {
+            free(buffer);
+            return err;
+        }
+    }
+    else
+        memcpy(powers, base, n);
+    // powers[i] = base^(2i + 1)
+    if (nb_powers > 1)
+    {
+        fp_poly_dense_sqr(prod, powers, n, order);
+        fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+        memcpy(res, prod, n);
+        for (size_t i = 1; i < nb_powers; i++)
+        {
+            fp_poly_dense_mul(prod, powers + (i - 1) * n, n, res, n, order);
+            fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+            memcpy(powers + i * n, prod, n);
+        }
+    }
+    mpz_t e;
+    mpz_init(e);
+    mpz_abs(e, exponent);
+    memset(res, 0, n);
+    res[0] = 1;
+    uint8_t is_one = 1;
+    size_t i = bits;
+    while (i > 0)
+    {
+        if (!mpz_tstbit(e, i - 1))
+        {
+            if (!is_one)
+            {
+                fp_poly_dense_sqr(prod, res, n, order);
+                fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+                memcpy(res, prod, n);
+            }
+            i--;
+            continue;
+        }
+        // the window covers the bits i - 1 down to j, the bit j being set
+        size_t j = i > k ? i - k : 0;
+        while (!mpz_tstbit(e, j))
+            j++;
+        size_t window = 0;
+        for (size_t b = i; b > j; b--)
+            window = 2 * window + mpz_tstbit(e, b - 1);
+        if (is_one)
+        {
+            memcpy(res, powers + (window / 2) * n, n);
+            is_one = 0;
+        }
+        else
+        {
+            for (size_t b = i; b > j; b--)
+            {
+                fp_poly_dense_sqr(prod, res, n, order);
+                fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+                memcpy(res, prod, n);
+            }
+            fp_poly_dense_mul(prod, res, n, powers + (window / 2) * n, n, order);
+            fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+            memcpy(res, prod, n);
+        }
+        i = j;
+    }
+    mpz_clear(e);
+    free(buffer);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the power of a polynom within a Galois field, i.e., modulo its irreducible polynom.
+ *
+ * @details The polynom is reduced by the prepared modulus of the field and raised with fp_poly_modulus_powmod().
+ *
+ * @param res The polynom which will store the power.
+ * @param base The polynom.
+ * @param exponent The exponent (a negative exponent raises the inverse of the polynom).
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_powmod(fp_poly_t **res, fp_poly_t *base, mpz_t exponent, fp_field_t *f)
+{
+    if (!base)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!f->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = f->modulus->degree, len_base = fp_poly_degree(base) + 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_base + 2 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *dense_base = buffer, *reduced = buffer + len_base, *power = buffer + len_base + n, *scratch = power + n;
+    fp_poly_to_dense(dense_base, len_base, base, f->order);
+    fp_poly_modulus_reduce(dense_base, len_base, scratch, f->modulus, f->order);
+    memset(reduced, 0, n);
+    memcpy(reduced, dense_base, len_base < n ? len_base : n);
+    fp_poly_error_t err = fp_poly_modulus_powmod(power, reduced, exponent, f);
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    *res = fp_poly_init_array(power, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Build the Frobenius matrix of a field, if it is not built yet.
+ *
+ * @details The matrix is optional: it is only built by this function, never by the operations that use it, so that a field stays read-only once built (see fp_poly_modulus_frobenius()). <br>
+ * Since the coefficients lie in F_p, the map h -> h^p modulo the irreducible polynom f of degree n is linear, and its matrix holds the coefficients of x^(pj) mod f in its column j. <br>
+ * The column 1 is computed with fp_poly_modulus_powmod(), and each next column is the previous one multiplied by x^p modulo f, i.e., n modular multiplications overall. <br>
+ * The matrix is stored row by row in the field, so that every later p-th power costs a single matrix-vector product (see fp_poly_modulus_frobenius()).
+ *
+ * @param field The field (with a prepared modulus).
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_init_frobenius(fp_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!field->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    if (field->frobenius)
+        return FP_POLY_E_SUCCESS;
+    size_t n = field->modulus->degree;
+    uint8_t order = field->order;
+    uint8_t *frobenius = (uint8_t *) malloc(n * n);
+    uint8_t *buffer = (uint8_t *) malloc(4 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!frobenius || !buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        free(frobenius);
+        free(buffer);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *x_p = buffer, *column = buffer + n, *prod = buffer + 2 * n, *scratch = buffer + 4 * n;
+    // x^p mod f (x itself is reduced by fp_poly_modulus_powmod() when n = 1)
+    memset(column, 0, n);
+    if (n > 1)
+        column[1] = 1;
+    else
+        column[0] = (order - field->modulus->coeff[0]) % order * field->modulus->lc_inv % order;
+    mpz_t p;
+    mpz_init_set_ui(p, order);
+    fp_poly_error_t err = fp_poly_modulus_powmod(x_p, column, p, field);
+    mpz_clear(p);
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        free(frobenius);
+        free(buffer);
+        return err;
+    }
+    memset(column, 0, n);
+    column[0] = 1;
+    for (size_t j = 0; j < n; j++)
+    {
+        if (j > 0)
+        {
+            fp_poly_dense_mul(prod, column, n, x_p, n, order);
+            fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, field->modulus, order);
+            memcpy(column, prod, n);
+        }
+        for (size_t i = 0; i < n; i++)
+            frobenius[i * n + j] = column[i];
+    }
+    free(buffer);
+    field->frobenius = frobenius;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the p-th power of a dense polynom modulo the irreducible polynom of a field with the Frobenius matrix.
+ *
+ * @details Once the Frobenius matrix is built (see fp_poly_init_frobenius()), each p-th power is a matrix-vector product of n^2 multiply-adds, whatever the order of the field. <br>
+ * Otherwise, the p-th power is computed by fp_poly_modulus_powmod(), and the field is left untouched.
+ *
+ * @param res The dense array which will store the p-th power (n coefficients, must not overlap \p a).
+ * @param a The dense polynom (n coefficients).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_modulus_frobenius(uint8_t *res, const uint8_t *a, fp_field_t *field)
+{
+    if (!res || !a)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!field->frobenius)
+    {
+        mpz_t p;
+        mpz_init_set_ui(p, field->order);
+        fp_poly_error_t err = fp_poly_modulus_powmod(res, a, p, field);
+        mpz_clear(p);
+        return err;
+    }
+    size_t n = field->modulus->degree;
+    for (size_t i = 0; i < n; i++)
+    {
+        const uint8_t *row = field->frobenius + i * n;
+        uint64_t acc = 0;
+        for (size_t j = 0; j < n; j++)
+            acc += (uint16_t) row[j] * a[j];
+        res[i] = acc % field->order;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the p-th power of a polynom within a Galois field, i.e., modulo its irreducible polynom.
+ *
+ * @details The polynom is reduced by the prepared modulus of the field and raised with the Frobenius matrix, if it has been built by fp_poly_init_frobenius() (see fp_poly_modulus_frobenius()).
+ *
+ * @param res The polynom which will store the p-th power.
+ * @param a The polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_frobenius(fp_poly_t **res, fp_poly_t *a, fp_field_t *f)
+{
+    if (!a)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!f->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = f->modulus->degree, len_a = fp_poly_degree(a) + 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_a + 2 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *dense_a = buffer, *reduced = buffer + len_a, *power = buffer + len_a + n, *scratch = power + n;
+    fp_poly_to_dense(dense_a, len_a, a, f->order);
+    fp_poly_modulus_reduce(dense_a, len_a, scratch, f->modulus, f->order);
+    memset(reduced, 0, n);
+    memcpy(reduced, dense_a, len_a < n ? len_a : n);
+    fp_poly_error_t err = fp_poly_modulus_frobenius(power, reduced, f);
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    *res = fp_poly_init_array(power, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the trace of a polynom within a Galois field over its prime field.
+ *
+ * @details The trace of a in F_{p^n} is a + a^p + ... + a^(p^(n - 1)), which lies in F_p. <br>
+ * The conjugates are computed one after the other with the Frobenius matrix (see fp_poly_modulus_frobenius()), so the whole computation costs n matrix-vector products and no modular multiplication once the matrix has been built by fp_poly_init_frobenius().
+ *
+ * @param res The parameter which will store the trace.
+ * @param a The polynom.
+ * @param f The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_trace(uint8_t *res, fp_poly_t *a, fp_field_t *f)
+{
+    if (!a || !res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!f)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!f->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = f->modulus->degree, len_a = fp_poly_degree(a) + 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_a + 2 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *dense_a = buffer, *conjugate = buffer + len_a, *next = buffer + len_a + n, *scratch = next + n;
+    fp_poly_to_dense(dense_a, len_a, a, f->order);
+    fp_poly_modulus_reduce(dense_a, len_a, scratch, f->modulus, f->order);
+    memset(conjugate, 0, n);
+    memcpy(conjugate, dense_a, len_a < n ? len_a : n);
+    // only the constant coefficient of the sum is needed, the other ones cancel out
+    uint16_t trace = conjugate[0];
+    for (size_t i = 1; i < n; i++)
+    {
+        fp_poly_error_t err = fp_poly_modulus_frobenius(next, conjugate, f);
+        if (err != FP_POLY_E_SUCCESS)
+        {
+            free(buffer);
+            return err;
+        }
+        memcpy(conjugate, next, n);
+        trace = (trace + conjugate[0]) % f->order;
+    }
+    free(buffer);
+    *res = trace;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the composition of two dense polynoms modulo the irreducible polynom of a field with the Brent–Kung method.
+ *
+ * @details Let k be about the square root of the length m of \p f. The baby steps g^0, ..., g^k mod h are computed once, and \p f is cut into blocks of k coefficients, i.e., f(y) = sum_j F_j(y) y^(jk). <br>
+ * Each F_j(g) mod h is a row of the product of the matrix of the blocks of \p f by the matrix of the baby steps, which is accumulated on 32-bit integers one row at a time. <br>
+ * The rows are then combined with the Horner method in g^k (the giant step), so that the whole composition costs about 2 sqrt(m) modular multiplications and m n multiply-adds.
+ *
+ * @param res The dense array which will store f(g) mod h (n coefficients, where n is the degree of the modulus).
+ * @param f The dense polynom.
+ * @param len_f The length of \p f.
+ * @param g The dense polynom (n coefficients, reduced modulo h).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_modulus_compose(uint8_t *res, const uint8_t *f, size_t len_f, const uint8_t *g, fp_field_t *field)
+{
+    if (!res || !f || !g)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_modulus_t *modulus = field->modulus;
+    if (!modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    uint8_t order = field->order;
+    size_t n = modulus->degree;
+    memset(res, 0, n);
+    if (len_f == 0)
+        return FP_POLY_E_SUCCESS;
+    size_t k = 1;
+    while (k * k < len_f)
+        k++;
+    size_t nb_blocks = (len_f + k - 1) / k;
+    uint8_t *buffer = (uint8_t *) malloc((k + 1) * n + 2 * n - 1 + FP_POLY_MODULUS_SCRATCH(n));
+    uint32_t *acc = (uint32_t *) malloc(n * sizeof(uint32_t));
+    if (!buffer || !acc)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        free(buffer);
+        free(acc);
+        return FP_POLY_E_MEMORY;
+    }
+    // baby steps: powers[i] = g^i mod h for i = 0, ..., k
+    uint8_t *powers = buffer, *prod = buffer + (k + 1) * n, *scratch = prod + 2 * n - 1;
+    memset(powers, 0, n);
+    powers[0] = 1;
+    fp_poly_modulus_reduce(powers, n, scratch, modulus, order);
+    for (size_t i = 1; i <= k; i++)
+    {
+        fp_poly_dense_mul(prod, powers + (i - 1) * n, n, g, n, order);
+        fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+        memcpy(powers + i * n, prod, n);
+    }
+    // giant steps: res = res * g^k + F_j(g) for j = nb_blocks - 1, ..., 0
+    for (size_t j = nb_blocks; j > 0; j--)
+    {
+        size_t start = (j - 1) * k, len_block = len_f - start < k ? len_f - start : k;
+        memset(acc, 0, n * sizeof(uint32_t));
+        for (size_t i = 0; i < len_block; i++)
+        {
+            uint8_t c = f[start + i] % order;
+            if (c == 0)
+                continue;
+            const uint8_t *row = powers + i * n;
+            for (size_t l = 0; l < n; l++)
+                acc[l] += (uint16_t) c * row[l];
+            // keep the accumulators below 2^32 (each step adds less than 2^16)
+            if (i % 65536 == 65535)
+                for (size_t l = 0; l < n; l++)
+                    acc[l] %= order;
+        }
+        if (j < nb_blocks)
+        {
+            fp_poly_dense_mul(prod, res, n, powers + k * n, n, order);
+            fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, modulus, order);
+        }
+        else
+            memset(prod, 0, n);
+        for (size_t l = 0; l < n; l++)
+            res[l] = (prod[l] + acc[l]) % order;
+    }
+    free(buffer);
+    free(acc);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the composition of two polynoms within a Galois field, i.e., f(g) modulo its irreducible polynom.
+ *
+ * @details The polynom \p g is reduced by the prepared modulus of the field, and the composition is computed by fp_poly_modulus_compose() (Brent–Kung method).
+ *
+ * @param res The polynom which will store f(g) mod h.
+ * @param f The outer polynom.
+ * @param g The inner polynom.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_compose_mod(fp_poly_t **res, fp_poly_t *f, fp_poly_t *g, fp_field_t *field)
+{
+    if (!f || !g)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!field->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = field->modulus->degree, len_f = fp_poly_degree(f) + 1, len_g = fp_poly_degree(g) + 1;
+    uint8_t *buffer = (uint8_t *) malloc(len_f + len_g + 2 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *dense_f = buffer, *dense_g = buffer + len_f, *reduced = dense_g + len_g, *composition = reduced + n, *scratch = composition + n;
+    fp_poly_to_dense(dense_f, len_f, f, field->order);
+    fp_poly_to_dense(dense_g, len_g, g, field->order);
+    fp_poly_modulus_reduce(dense_g, len_g, scratch, field->modulus, field->order);
+    memset(reduced, 0, n);
+    memcpy(reduced, dense_g, len_g < n ? len_g : n);
+    fp_poly_error_t err = fp_poly_modulus_compose(composition, dense_f, len_f, reduced, field);
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    *res = fp_poly_init_array(composition, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Reduce an integer lower than 2^17 modulo the order of the field without division.
+ *
+ * @details The quotient is estimated with the single precision reciprocal of the order, which is off by at most one, and the remainder is corrected by a conditional addition or substraction. This uses neither division nor branch, so that the loops over the lanes of the Horner kernel are vectorized by the compiler.
+ *
+ * @param v The integer.
+ * @param order The order of the field.
+ * @param inv The reciprocal 1 / order.
+ *
+ * @return The integer modulo the order.
+ */
+static inline uint16_t fp_poly_lane_reduce(uint32_t v, uint8_t order, float inv)
+{
+    int32_t r = (int32_t) v - (int32_t) ((float) v * inv) * order;
+    r = r < 0 ? r + order : r;
+    r = r >= order ? r - order : r;
+    return (uint16_t) r;
+}
+
+/**
+ * @brief Reduce an exponent of an element of a prime field with the Fermat little theorem.
+ *
+ * @details For x != 0, x^(p - 1) = 1, so that x^e = x^(((e - 1) mod (p - 1)) + 1) when e > 0. The reduced exponent is still positive, so that the identity also holds for x = 0.
+ *
+ * @param e The exponent.
+ * @param order The order p of the field.
+ *
+ * @return The reduced exponent, between 1 and p - 1 (or 0 if \p e is 0).
+ */
+static inline size_t fp_poly_fermat_exponent(size_t e, uint8_t order)
+{
+    return e ? (e - 1) % (order - 1) + 1 : 0;
+}
+
+/**
+ * @brief Multiply each lane by the same power of its point.
+ *
+ * @param acc The @ref FP_POLY_HORNER_LANES lanes.
+ * @param x The @ref FP_POLY_HORNER_LANES points.
+ * @param e The exponent.
+ * @param order The order of the field.
+ * @param inv The reciprocal 1 / order.
+ */
+static void fp_poly_lanes_mul_pow(uint16_t *acc, const uint16_t *x, size_t e, uint8_t order, float inv)
+{
+    uint16_t square[FP_POLY_HORNER_LANES];
+    memcpy(square, x, sizeof(square));
+    while (e)
+    {
+        if (e & 1)
+            for (size_t l = 0; l < FP_POLY_HORNER_LANES; l++)
+                acc[l] = fp_poly_lane_reduce((uint32_t) acc[l] * square[l], order, inv);
+        e >>= 1;
+        if (e)
+            for (size_t l = 0; l < FP_POLY_HORNER_LANES; l++)
+                square[l] = fp_poly_lane_reduce((uint32_t) square[l] * square[l], order, inv);
+    }
+}
+
+/**
+ * @brief Evaluate a polynom at up to @ref FP_POLY_HORNER_LANES points with the Horner method.
+ *
+ * @details The terms are walked once from the highest degree to the lowest one, and each step updates all the lanes with the same multiply-add. <br>
+ * A gap of g > 1 degrees between two consecutive terms is skipped by a multiplication by x^(g - 1), whose exponent is first reduced by fp_poly_fermat_exponent(), so that it costs at most 8 squarings.
+ *
+ * @param values The array which will store the values.
+ * @param coeff The coefficients of the terms, by increasing degree.
+ * @param degree The degrees of the terms, or NULL for a dense polynom (the degree of coeff[i] is i).
+ * @param nb_terms The number of terms (at least one).
+ * @param points The points.
+ * @param nb_points The number of points (at most @ref FP_POLY_HORNER_LANES).
+ * @param order The order of the field.
+ */
+static void fp_poly_horner_block(uint8_t *values, const uint8_t *coeff, const size_t *degree, size_t nb_terms, const uint8_t *points, size_t nb_points, uint8_t order)
+{
+    uint16_t acc[FP_POLY_HORNER_LANES], x[FP_POLY_HORNER_LANES];
+    float inv = 1.0f / order;
+    for (size_t l = 0; l < FP_POLY_HORNER_LANES; l++)
+    {
+        x[l] = l < nb_points ? points[l] % order : 0;
+        acc[l] = coeff[nb_terms - 1] % order;
+    }
+    for (size_t t = nb_terms - 1; t > 0; t--)
+    {
+        if (degree && degree[t] - degree[t - 1] > 1)
+            fp_poly_lanes_mul_pow(acc, x, fp_poly_fermat_exponent(degree[t] - degree[t - 1] - 1, order), order, inv);
+        uint8_t c = coeff[t - 1] % order;
+        for (size_t l = 0; l < FP_POLY_HORNER_LANES; l++)
+            acc[l] = fp_poly_lane_reduce((uint32_t) acc[l] * x[l] + c, order, inv);
+    }
+    if (degree && degree[0] > 0)
+        fp_poly_lanes_mul_pow(acc, x, fp_poly_fermat_exponent(degree[0], order), order, inv);
+    for (size_t l = 0; l < nb_points; l++)
+        values[l] = acc[l];
+}
+
+/**
+ * @brief Compute the inverse of a dense power series modulo x^k with the Newton iteration.
+ *
+ * @details Starting from g = 1 / a_0, each step doubles the precision l of the inverse with g <- g - g (a g - 1), where a g - 1 is a multiple of x^l. <br>
+ * The l useful coefficients of a g are a middle product (see fp_poly_dense_mulmid()) and the correction is a low product, so that the whole inversion costs a constant number of multiplications of length k.
+ *
+ * @param res The dense array which will store the inverse (k coefficients, must not overlap \p a).
+ * @param a The dense power series (its constant coefficient must be invertible).
+ * @param len_a The length of the dense power series.
+ * @param k The precision.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_dense_inv_series(uint8_t *res, const uint8_t *a, size_t len_a, size_t k, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    uint8_t *buffer = (uint8_t *) malloc(4 * k);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *shifted = buffer, *error = buffer + 2 * k, *correction = buffer + 3 * k;
+    res[0] = fp_poly_inv(a[0] % order, field);
+    for (size_t l = 1; l < k;)
+    {
+        size_t l2 = 2 * l < k ? 2 * l : k, len_t = l2 - l;
+        // a g = 1 + x^l t mod x^l2, where t is the middle product of a / x and g
+        for (size_t i = 0; i + 1 < 2 * l; i++)
+            shifted[i] = i + 1 < len_a ? a[i + 1] : 0;
+        fp_poly_dense_mulmid(error, shifted, res, l, order);
+        // g <- g - x^l (g t) mod x^l2
+        fp_poly_dense_mullow(correction, res, l, error, len_t, len_t, order);
+        for (size_t i = 0; i < len_t; i++)
+            res[l + i] = (order - correction[i]) % order;
+        l = l2;
+    }
+    free(buffer);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the remainder of the division of a dense polynom by a monic dense polynom.
+ *
+ * @details Below @ref FP_POLY_NEWTON_THRESHOLD coefficients of quotient, the schoolbook method is used (no inversion is needed since the divisor is monic). <br>
+ * Otherwise, with d the degree of \p b and k the length of the quotient, the reversed quotient is the product of the k leading coefficients of \p a reversed by the inverse of the reversed divisor modulo x^k, and the remainder is a - q b modulo x^d.
+ *
+ * @param res The dense array which will store the remainder (len_b - 1 coefficients).
+ * @param a The dividend.
+ * @param len_a The length of the dividend.
+ * @param b The monic divisor.
+ * @param len_b The length of the divisor.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_rem_monic(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    size_t d = len_b - 1;
+    if (len_a <= d)
+    {
+        memcpy(res, a, len_a);
+        memset(res + len_a, 0, d - len_a);
+        return FP_POLY_E_SUCCESS;
+    }
+    size_t k = len_a - d;
+    if (k < FP_POLY_NEWTON_THRESHOLD)
+    {
+        uint8_t *r = (uint8_t *) malloc(len_a);
+        if (!r)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            return FP_POLY_E_MEMORY;
+        }
+        memcpy(r, a, len_a);
+        for (size_t i = len_a; i > d; i--)
+        {
+            uint8_t c = r[i - 1] % order;
+            if (c == 0)
+                continue;
+            uint8_t minus_c = order - c;
+            for (size_t j = 0; j < d; j++)
+                r[i - 1 - d + j] = (r[i - 1 - d + j] + (uint16_t) minus_c * b[j]) % order;
+        }
+        memcpy(res, r, d);
+        free(r);
+        return FP_POLY_E_SUCCESS;
+    }
+    size_t len_rev_b = len_b < k ? len_b : k;
+    uint8_t *buffer = (uint8_t *) malloc(len_rev_b + 5 * k + len_a);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *rev_b = buffer, *inv = rev_b + len_rev_b, *rev_a = inv + k, *q = rev_a + k, *prod = q + k;
+    for (size_t i = 0; i < len_rev_b; i++)
+        rev_b[i] = b[d - i];
+    if (fp_poly_dense_inv_series(inv, rev_b, len_rev_b, k, field) != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return FP_POLY_E_MEMORY;
+    }
+    for (size_t i = 0; i < k; i++)
+        rev_a[i] = a[len_a - 1 - i];
+    fp_poly_dense_mullow(prod, rev_a, k, inv, k, k, order);
+    for (size_t i = 0; i < k; i++)
+        q[i] = prod[k - 1 - i];
+    fp_poly_dense_mullow(prod, q, k, b, len_b, d, order);
+    for (size_t i = 0; i < d; i++)
+        res[i] = (a[i] + order - prod[i]) % order;
+    free(buffer);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Build the subproduct tree of points of a prime field.
+ *
+ * @details See @ref fp_subproduct_tree_t for the layout of the tree. Each level is the product of the pairs of nodes of the previous level, so that building the tree costs O(M(m) log m) operations. <br>
+ * The tree only depends on the points, and may be reused by fp_poly_eval_tree() for several polynoms.
+ *
+ * @param points The points.
+ * @param len The number of points.
+ * @param field The field in which the points lie (their coefficients are reduced modulo the order of the field).
+ *
+ * @return The subproduct tree if the operation was successful or NULL otherwise.
+ */
+fp_subproduct_tree_t *fp_poly_subproduct_tree_init(const uint8_t *points, size_t len, fp_field_t *field)
+{
+    if (!points)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the points are NULL");
+        return NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    if (len == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "there is no point");
+        return NULL;
+    }
+    uint8_t order = field->order;
+    size_t height = 1;
+    while (((size_t) 1 << (height - 1)) < len)
+        height++;
+    fp_subproduct_tree_t *tree = (fp_subproduct_tree_t *) malloc(sizeof(fp_subproduct_tree_t));
+    if (!tree)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    tree->len = len;
+    tree->height = height;
+    tree->points = (uint8_t *) malloc(len);
+    tree->level = (uint8_t **) calloc(height, sizeof(uint8_t *));
+    if (!tree->points || !tree->level)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        free(tree->points);
+        free(tree->level);
+        free(tree);
+        return NULL;
+    }
+    for (size_t j = 0; j < height; j++)
+    {
+        size_t size = (size_t) 1 << j, nb_nodes = (len + size - 1) / size;
+        tree->level[j] = (uint8_t *) malloc(len + nb_nodes);
+        if (!tree->level[j])
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            fp_poly_subproduct_tree_free(tree);
+            return NULL;
+        }
+        for (size_t i = 0; i < nb_nodes; i++)
+        {
+            uint8_t *node = tree->level[j] + i * (size + 1);
+            if (j == 0)
+            {
+                tree->points[i] = points[i] % order;
+                node[0] = (order - tree->points[i]) % order;
+                node[1] = 1;
+                continue;
+            }
+            // children of 2^(j-1) points: the right one may be missing or shorter
+            size_t half = size / 2, len_left = len - 2 * i * half < half ? len - 2 * i * half : half;
+            uint8_t *left = tree->level[j - 1] + 2 * i * (half + 1);
+            if (2 * i * half + len_left == len)
+            {
+                memcpy(node, left, len_left + 1);
+                continue;
+            }
+            size_t len_right = len - (2 * i + 1) * half < half ? len - (2 * i + 1) * half : half;
+            fp_poly_dense_mul(node, left, len_left + 1, left + half + 1, len_right + 1, order);
+        }
+    }
+    return tree;
+}
+
+/**
+ * @brief Free a subproduct tree.
+ *
+ * @param tree The subproduct tree.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_subproduct_tree_free(fp_subproduct_tree_t *tree)
+{
+    if (!tree)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the subproduct tree is NULL");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    for (size_t j = 0; j < tree->height; j++)
+        free(tree->level[j]);
+    free(tree->level);
+    free(tree->points);
+    free(tree);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Evaluate a dense polynom at the points of a node of a subproduct tree (remainder tree).
+ *
+ * @details The polynom is first reduced modulo the node. Below @ref FP_POLY_TREE_HORNER_THRESHOLD points, the remainder is evaluated at all the points of the node with the batched Horner method, otherwise it is passed down to the children of the node.
+ *
+ * @param values The array which will store the values at the points of the node.
+ * @param a The dense polynom.
+ * @param len_a The length of the dense polynom.
+ * @param tree The subproduct tree.
+ * @param j The level of the node.
+ * @param i The index of the node in its level.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_eval_node(uint8_t *values, const uint8_t *a, size_t len_a, fp_subproduct_tree_t *tree, size_t j, size_t i, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    size_t size = (size_t) 1 << j, first = i * size;
+    size_t nb_points = tree->len - first < size ? tree->len - first : size;
+    uint8_t *rem = (uint8_t *) malloc(nb_points);
+    if (!rem)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_error_t err = fp_poly_dense_rem_monic(rem, a, len_a, tree->level[j] + i * (size + 1), nb_points + 1, field);
+    if (err == FP_POLY_E_SUCCESS && (j == 0 || nb_points <= FP_POLY_TREE_HORNER_THRESHOLD))
+    {
+        for (size_t k = 0; k < nb_points; k += FP_POLY_HORNER_LANES)
+            fp_poly_horner_block(values + k, rem, NULL, nb_points, tree->points + first + k, nb_points - k < FP_POLY_HORNER_LANES ? nb_points - k : FP_POLY_HORNER_LANES, order);
+    }
+    else if (err == FP_POLY_E_SUCCESS)
+    {
+        err = fp_poly_eval_node(values, rem, nb_points, tree, j - 1, 2 * i, field);
+        if (err == FP_POLY_E_SUCCESS && nb_points > size / 2)
+            err = fp_poly_eval_node(values + size / 2, rem, nb_points, tree, j - 1, 2 * i + 1, field);
+    }
+    free(rem);
+    return err;
+}
+
+/**
+ * @brief Evaluate a polynom at the points of a subproduct tree.
+ *
+ * @details The polynom is reduced modulo the root of the tree, then the remainders are passed down the tree (remainder tree), so that the evaluation at m points costs O(M(m) log m) operations, plus one division for polynoms of degree larger than m.
+ *
+ * @param values The array which will store the m values.
+ * @param p The polynom.
+ * @param tree The subproduct tree of the points.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_eval_tree(uint8_t *values, fp_poly_t *p, fp_subproduct_tree_t *tree, fp_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!values || !tree)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the values or the subproduct tree are NULL");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    size_t len_p = fp_poly_degree(p) + 1;
+    uint8_t *dense_p = (uint8_t *) malloc(len_p);
+    if (!dense_p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_to_dense(dense_p, len_p, p, field->order);
+    fp_poly_error_t err = fp_poly_eval_node(values, dense_p, len_p, tree, tree->height - 1, 0, field);
+    free(dense_p);
+    return err;
+}
+
+/**
+ * @brief Evaluate a polynom at several points of a prime field.
+ *
+ * @details The subproduct tree of the points is built by fp_poly_subproduct_tree_init() and the polynom is evaluated by fp_poly_eval_tree(). When the points are fixed, the tree should be built once and reused.
+ *
+ * @param values The array which will store the \p len values.
+ * @param p The polynom.
+ * @param points The points.
+ * @param len The number of points.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_eval_multi(uint8_t *values, fp_poly_t *p, const uint8_t *points, size_t len, fp_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (len == 0)
+        return FP_POLY_E_SUCCESS;
+    fp_subproduct_tree_t *tree = fp_poly_subproduct_tree_init(points, len, field);
+    if (!tree)
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    fp_poly_error_t err = fp_poly_eval_tree(values, p, tree, field);
+    fp_poly_subproduct_tree_free(tree);
+    return err;
+}
+
+/**
+ * @brief Interpolate a polynom through the points of a subproduct tree.
+ *
+ * @details Let M be the root of the tree. The weights c_i = y_i / M'(a_i) are computed with the remainder tree of M', then the linear combination sum_i c_i M / (x - a_i) is built up the tree: the combination of a node is r_left M_right + r_right M_left. <br>
+ * The interpolation of m points thus costs O(M(m) log m) operations, and the tree may be shared with fp_poly_eval_tree() when the abscissas repeat.
+ *
+ * @param res The polynom which will store the unique polynom of degree lower than m such that res(a_i) = y_i.
+ * @param values The m values y_i.
+ * @param tree The subproduct tree of the m abscissas a_i (which must be distinct).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_interpolate_tree(fp_poly_t **res, const uint8_t *values, fp_subproduct_tree_t *tree, fp_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!values || !tree)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the values or the subproduct tree are NULL");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    uint8_t order = field->order;
+    size_t len = tree->len;
+    uint8_t *buffer = (uint8_t *) malloc(4 * len);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *current = buffer, *next = buffer + len, *prod_left = next + len, *prod_right = prod_left + len;
+    // derivative of the root, evaluated at the abscissas
+    const uint8_t *root = tree->level[tree->height - 1];
+    for (size_t i = 0; i < len; i++)
+        prod_left[i] = (uint16_t) root[i + 1] * ((i + 1) % order) % order;
+    fp_poly_error_t err = fp_poly_eval_node(current, prod_left, len, tree, tree->height - 1, 0, field);
+    if (err != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    for (size_t i = 0; i < len; i++)
+    {
+        if (current[i] == 0)
+        {
+            free(buffer);
+            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the abscissas are not distinct");
+            return FP_POLY_E_POLYNOM_MANIPULATION;
+        }
+        current[i] = (uint16_t) (values[i] % order) * fp_poly_inv(current[i], field) % order;
+    }
+    // linear combination: the node i of the level j stores its combination at index i 2^j
+    for (size_t j = 1; j < tree->height; j++)
+    {
+        size_t size = (size_t) 1 << j, half = size / 2;
+        for (size_t first = 0; first < len; first += size)
+        {
+            size_t len_left = len - first < half ? len - first : half;
+            if (first + len_left == len)
+            {
+                memcpy(next + first, current + first, len_left);
+                continue;
+            }
+            size_t len_right = len - first - half < half ? len - first - half : half;
+            const uint8_t *left = tree->level[j - 1] + first / half * (half + 1), *right = left + half + 1;
+            fp_poly_dense_mul(prod_left, current + first, len_left, right, len_right + 1, order);
+            fp_poly_dense_mul(prod_right, current + first + half, len_right, left, len_left + 1, order);
+            for (size_t k = 0; k < len_left + len_right; k++)
+                next[first + k] = (prod_left[k] + prod_right[k]) % order;
+        }
+        uint8_t *tmp = current;
+        current = next;
+        next = tmp;
+    }
+    size_t len_res = len;
+    while (len_res > 1 && current[len_res - 1] == 0)
+        len_res--;
+    *res = fp_poly_init_array(current, len_res);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Interpolate a polynom through points of a prime field.
+ *
+ * @details The subproduct tree of the abscissas is built by fp_poly_subproduct_tree_init() and the polynom is computed by fp_poly_interpolate_tree(). When the abscissas are fixed, the tree should be built once and reused.
+ *
+ * @param res The polynom which will store the unique polynom of degree lower than \p len such that res(points[i]) = values[i].
+ * @param points The abscissas (which must be distinct).
+ * @param values The values.
+ * @param len The number of points.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_interpolate(fp_poly_t **res, const uint8_t *points, const uint8_t *values, size_t len, fp_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    fp_subproduct_tree_t *tree = fp_poly_subproduct_tree_init(points, len, field);
+    if (!tree)
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    fp_poly_error_t err = fp_poly_interpolate_tree(res, values, tree, field);
+    fp_poly_subproduct_tree_free(tree);
+    return err;
+}
+
+/**
+ * @brief Evaluate a polynom at a point of a prime field, iterating only over its terms.
+ *
+ * @details The degrees of the terms are read with mpz_scan1() in increasing order, so that the cost does not depend on the gaps between the terms. <br>
+ * Since x^(p - 1) = 1 for x != 0, the monomial x^d (d > 0) is x^e with e = ((d - 1) mod (p - 1)) + 1 < 2^8 (this also holds for x = 0). The squarings x^(2^i) are computed once and shared by all the terms, so that each monomial costs at most 8 multiplications whatever its degree.
+ *
+ * @param res The value of the polynom at the point.
+ * @param p The polynom.
+ * @param x The point.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_eval(uint8_t *res, fp_poly_t *p, uint8_t x, fp_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!res)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the value is NULL");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    uint8_t order = field->order;
+    uint16_t square[8];
+    square[0] = x % order;
+    for (size_t i = 1; i < 8; i++)
+        square[i] = square[i - 1] * square[i - 1] % order;
+    uint32_t value = 0;
+    mp_bitcnt_t d = 0;
+    for (list_node_t *node = p->coeff->head; node != NULL; node = node->next, d++)
+    {
+        d = mpz_scan1(p->index_coeff, d);
+        uint16_t monomial = 1;
+        for (size_t e = fp_poly_fermat_exponent(d, order), i = 0; e; e >>= 1, i++)
+            if (e & 1)
+                monomial = monomial * square[i] % order;
+        value = (value + (uint32_t) monomial * (node->coeff % order)) % order;
+    }
+    *res = value;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Evaluate a polynom at several points of a prime field with a batched Horner method.
+ *
+ * @details The points are processed by blocks of @ref FP_POLY_HORNER_LANES, and the terms of the polynom are walked once per block from the highest degree to the lowest one. The gaps between the terms are skipped by exponentiation, so that the cost is O(t) multiply-adds per point for a polynom with t terms, whatever its degree. <br>
+ * Below a few hundred points, this is faster than fp_poly_eval_multi().
+ *
+ * @param values The array which will store the \p len values.
+ * @param p The polynom.
+ * @param points The points.
+ * @param len The number of points.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_eval_horner(uint8_t *values, fp_poly_t *p, const uint8_t *points, size_t len, fp_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!values || !points)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the values or the points are NULL");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    size_t nb_terms = p->coeff->size;
+    uint8_t *coeff = (uint8_t *) malloc(nb_terms);
+    size_t *degree = (size_t *) malloc(nb_terms * sizeof(size_t));
+    if (!coeff || !degree)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        free(coeff);
+        free(degree);
+        return FP_POLY_E_MEMORY;
+    }
+    size_t t = 0, d = 0;
+    for (list_node_t *node = p->coeff->head; node != NULL; node = node->next, t++, d++)
+    {
+        d = mpz_scan1(p->index_coeff, d);
+        coeff[t] = node->coeff;
+        degree[t] = d;
+    }
+    for (size_t i = 0; i < len; i += FP_POLY_HORNER_LANES)
+        fp_poly_horner_block(values + i, coeff, degree, nb_terms, points + i, len - i < FP_POLY_HORNER_LANES ? len - i : FP_POLY_HORNER_LANES, field->order);
+    free(coeff);
+    free(degree);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Free the Zech logarithm tables of a field.
+ *
+ * @param zech The Zech logarithm tables.
+ */
+static void fp_poly_zech_free(fp_zech_t *zech)
+{
+    if (!zech)
+        return;
+    free(zech->log);
+    free(zech->exp);
+    free(zech->zech);
+    free(zech);
+}
+
+/**
+ * @brief Encode a dense element of a Galois field as an integer, i.e., c_0 + c_1 p + ... + c_{n-1} p^(n-1).
+ *
+ * @param a The dense element (n coefficients).
+ * @param n The degree of the modulus.
+ * @param order The order p of the prime field.
+ *
+ * @return The integer encoding of the element.
+ */
+static size_t fp_poly_zech_encode(const uint8_t *a, size_t n, uint8_t order)
+{
+    size_t res = 0;
+    for (size_t i = n; i > 0; i--)
+        res = res * order + a[i - 1];
+    return res;
+}
+
+/**
+ * @brief Decode an integer into a dense element of a Galois field (see fp_poly_zech_encode()).
+ *
+ * @param res The dense array which will store the element (n coefficients).
+ * @param code The integer encoding of the element.
+ * @param n The degree of the modulus.
+ * @param order The order p of the prime field.
+ */
+static void fp_poly_zech_decode(uint8_t *res, size_t code, size_t n, uint8_t order)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        res[i] = code % order;
+        code /= order;
+    }
+}
+
+/**
+ * @brief Check if a dense element generates the multiplicative group of a Galois field of q elements.
+ *
+ * @details The element g is a generator if and only if g^(q - 1) = 1 and g^((q - 1) / r) != 1 for each prime factor r of q - 1. <br>
+ * When the modulus is reducible, there are fewer than q - 1 units, so no element passes the test.
+ *
+ * @param g The dense element (n coefficients).
+ * @param q The number of elements of the field.
+ * @param power A scratch dense array of n coefficients.
+ * @param field The field.
+ *
+ * @return 1 if the element is a generator, 0 otherwise.
+ */
+static uint8_t fp_poly_zech_is_generator(const uint8_t *g, size_t q, uint8_t *power, fp_field_t *field)
+{
+    size_t n = field->modulus->degree;
+    mpz_t e;
+    mpz_init_set_ui(e, q - 1);
+    uint8_t is_generator = fp_poly_modulus_powmod(power, g, e, field) == FP_POLY_E_SUCCESS && fp_poly_zech_encode(power, n, field->order) == 1;
+    size_t m = q - 1;
+    for (size_t r = 2; is_generator && m > 1; r++)
+    {
+        if (r * r > m)
+            r = m;
+        if (m % r != 0)
+            continue;
+        while (m % r == 0)
+            m /= r;
+        mpz_set_ui(e, (q - 1) / r);
+        if (fp_poly_modulus_powmod(power, g, e, field) != FP_POLY_E_SUCCESS || fp_poly_zech_encode(power, n, field->order) == 1)
+            is_generator = 0;
+    }
+    mpz_clear(e);
+    return is_generator;
+}
+
+/**
+ * @brief Build the Zech logarithm tables of a Galois field, if they are not built yet.
+ *
+ * @details The tables are optional: they are only built by this function, and the functions fp_poly_zech_*() report FP_POLY_E_FIELD_MANIPULATION until it has been called. <br>
+ * A generator g of the multiplicative group is searched among the first @ref FP_POLY_ZECH_CANDIDATES elements following x (see fp_poly_zech_is_generator()). <br>
+ * The successive powers of g fill the table of the logarithms (from the integer encoding of an element to its identifier) and the table of the exponentials (from a logarithm to the integer encoding), and the Zech logarithms log(1 + g^k) are derived from them. <br>
+ * See @ref fp_zech_t for the identifiers of the elements.
+ *
+ * @param field The field (with a prepared modulus and at most @ref FP_POLY_ZECH_MAX_ORDER elements).
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_init_zech(fp_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!field->modulus)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the modulus is not prepared");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    if (field->zech)
+        return FP_POLY_E_SUCCESS;
+    uint8_t order = field->order;
+    size_t n = field->modulus->degree, q = 1;
+    for (size_t i = 0; i < n && q <= FP_POLY_ZECH_MAX_ORDER; i++)
+        q *= order;
+    if (q > FP_POLY_ZECH_MAX_ORDER || q < 3)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the number of elements of the field is not supported");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    fp_zech_t *zech = (fp_zech_t *) malloc(sizeof(fp_zech_t));
+    uint8_t *buffer = (uint8_t *) malloc(4 * n + FP_POLY_MODULUS_SCRATCH(n));
+    if (!zech || !buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        free(zech);
+        free(buffer);
+        return FP_POLY_E_MEMORY;
+    }
+    zech->size = q;
+    zech->log = (uint16_t *) malloc(q * sizeof(uint16_t));
+    zech->exp = (uint16_t *) malloc((q - 1) * sizeof(uint16_t));
+    zech->zech = (uint16_t *) malloc((q - 1) * sizeof(uint16_t));
+    if (!zech->log || !zech->exp || !zech->zech)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        fp_poly_zech_free(zech);
+        free(buffer);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *g = buffer, *power = buffer + n, *prod = buffer + 2 * n, *scratch = buffer + 4 * n;
+    size_t code = order % q, tries = 0;
+    for (; tries < FP_POLY_ZECH_CANDIDATES; tries++, code = code + 1 < q ? code + 1 : 2)
+    {
+        fp_poly_zech_decode(g, code, n, order);
+        if (code > 1 && fp_poly_zech_is_generator(g, q, power, field))
+            break;
+    }
+    if (tries == FP_POLY_ZECH_CANDIDATES)
+    {
+        fp_poly_zech_free(zech);
+        free(buffer);
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "no generator found (the modulus may be reducible)");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    // the identifier of g^k is k + 1, and 0 is the identifier of zero
+    zech->log[0] = 0;
+    memset(power, 0, n);
+    power[0] = 1;
+    for (size_t k = 0; k < q - 1; k++)
+    {
+        size_t code_power = fp_poly_zech_encode(power, n, order);
+        zech->exp[k] = code_power;
+        zech->log[code_power] = k + 1;
+        fp_poly_dense_mul(prod, power, n, g, n, order);
+        fp_poly_modulus_reduce(prod, 2 * n - 1, scratch, field->modulus, order);
+        memcpy(power, prod, n);
+    }
+    // 1 + g^k only differs from g^k by its constant coefficient
+    for (size_t k = 0; k < q - 1; k++)
+    {
+        size_t code_power = zech->exp[k], c = code_power % order;
+        zech->zech[k] = zech->log[code_power - c + (c + 1) % order];
+    }
+    free(buffer);
+    field->zech = zech;
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Retrieve the identifier of an element of a Galois field in the Zech logarithm representation.
+ *
+ * @param res The parameter which will store the identifier of the element (see @ref fp_zech_t).
+ * @param p The polynom (it is reduced modulo the irreducible polynom).
+ * @param field The field, with Zech logarithm tables.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_zech_from_poly(uint16_t *res, fp_poly_t *p, fp_field_t *field)
+{
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!field->zech)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no Zech logarithm tables (see fp_poly_init_zech())");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    size_t n = field->modulus->degree, len = fp_poly_degree(p) + 1, len_dense = len > n ? len : n;
+    uint8_t *dense = (uint8_t *) malloc(len_dense + FP_POLY_MODULUS_SCRATCH(n));
+    if (!dense)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    memset(dense, 0, len_dense);
+    fp_poly_to_dense(dense, len, p, field->order);
+    fp_poly_modulus_reduce(dense, len, dense + len_dense, field->modulus, field->order);
+    *res = field->zech->log[fp_poly_zech_encode(dense, n, field->order)];
+    free(dense);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Create the polynom of an element of a Galois field given in the Zech logarithm representation.
+ *
+ * @param res The polynom which will store the element.
+ * @param a The identifier of the element (see @ref fp_zech_t).
+ * @param field The field, with Zech logarithm tables.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_poly_zech_to_poly(fp_poly_t **res, uint16_t a, fp_field_t *field)
+{
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (!field->zech)
     {
-        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
-        return FP_POLY_E_MEMORY;
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no Zech logarithm tables (see fp_poly_init_zech())");
+        return FP_POLY_E_FIELD_MANIPULATION;
     }
-    mpz_set_ui((*q)->index_coeff, 0x1);
-    if (list_add_beginning((*q)->coeff, 0) != LIST_E_SUCCESS)
+    if (a >= field->zech->size)
     {
-        fp_poly_error(FP_POLY_E_LIST_COEFFICIENT, __FILE__, __func__, __LINE__, "list_add_beginning() failed");
-        return FP_POLY_E_LIST_COEFFICIENT;
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the identifier is not an element of the field");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
     }
-    fp_poly_t *t;
-    if ((t = fp_poly_init()) == NULL)
+    size_t n = field->modulus->degree;
+    uint8_t *dense = (uint8_t *) malloc(n);
+    if (!dense)
     {
         fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
         return FP_POLY_E_MEMORY;
     }
-    if (list_add_beginning(t->coeff, 0) != LIST_E_SUCCESS)
-    {
-        fp_poly_error(FP_POLY_E_LIST_COEFFICIENT, __FILE__, __func__, __LINE__, "list_add_beginning() failed");
-        return FP_POLY_E_LIST_COEFFICIENT;
-    }
-    mpz_t bitwise;
-    mpz_init(bitwise);
-    while (fp_poly_is_zero(*r) == 0 && fp_poly_degree(*r) >= fp_poly_degree(d))
+    fp_poly_zech_decode(dense, a == 0 ? 0 : field->zech->exp[a - 1], n, field->order);
+    *res = fp_poly_init_array(dense, n);
+    free(dense);
+    if (!*res)
     {
-        mpz_set_ui(bitwise, 0);
-        mpz_setbit(bitwise, fp_poly_degree(*r) - fp_poly_degree(d));
-        mpz_set(t->index_coeff, bitwise);
-        uint16_t tmp = (uint16_t) fp_poly_inv(d->coeff->tail->coeff, f) * (uint16_t) (*r)->coeff->tail->coeff;
-        tmp = tmp % f->order;
-        t->coeff->tail->coeff = (uint8_t) tmp;
-        fp_poly_t *mem = *q;
-        fp_poly_error_t err;
-        if ((err = fp_poly_add(q, *q, t, f) != FP_POLY_E_SUCCESS))
-        {
-            fp_poly_error(err, __FILE__, __func__, __LINE__, "");
-            return err;
-        }
-        if (fp_poly_free(mem) != FP_POLY_E_SUCCESS)
-        {
-            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "");
-            return FP_POLY_E_POLYNOM_MANIPULATION;
-        }
-        fp_poly_t *intermediate;
-        if ((err = fp_poly_mul(&intermediate, t, d, f)) != FP_POLY_E_SUCCESS)
-        {
-            fp_poly_error(err, __FILE__, __func__, __LINE__, "");
-            return err;
-        }
-        mem = *r;
-        if ((err = fp_poly_sub(r, *r, intermediate, f)) != FP_POLY_E_SUCCESS)
-        {
-            fp_poly_error(err, __FILE__, __func__, __LINE__, "");
-            return err;
-        }
-        fp_poly_free(mem);
-        fp_poly_free(intermediate);
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
     }
-    fp_poly_free(t);
-    mpz_clear(bitwise);
     return FP_POLY_E_SUCCESS;
 }
 
 /**
- * @brief Compute the greatest common divisor of two polynoms.
- * 
- * @param res The polynom which will store the greatest common divisor.
- * @param p The first polynom.
- * @param q The second polynom.
- * @param f The field in which the operation is performed.
- * 
- * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ * @brief Multiply two elements of a Galois field in the Zech logarithm representation, i.e., add their logarithms modulo q - 1.
+ *
+ * @param a The identifier of the first element.
+ * @param b The identifier of the second element.
+ * @param field The field, with Zech logarithm tables.
+ *
+ * @return The identifier of the product, or 0 if the field has no Zech logarithm tables (see fp_poly_init_zech()).
  */
-fp_poly_error_t fp_poly_gcd(fp_poly_t **res, fp_poly_t *p, fp_poly_t *q, fp_field_t *f)
+uint16_t fp_poly_zech_mul(uint16_t a, uint16_t b, fp_field_t *field)
 {
-    fp_poly_t *r1 = fp_poly_init_mpz(p->index_coeff, list_copy(p->coeff));
-    if (!r1)
+    if (!field || !field->zech)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "initialisation of polynom failed");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
-    }
-    fp_poly_t *r2 = fp_poly_init_mpz(q->index_coeff, list_copy(q->coeff));
-    if (!r2)
-    {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "initialisation of polynom failed");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no Zech logarithm tables");
+        return 0;
     }
-    while (fp_poly_is_zero(r2) == 0)
+    if (a == 0 || b == 0)
+        return 0;
+    size_t k = (size_t) (a - 1) + (b - 1), q_1 = field->zech->size - 1;
+    return (k >= q_1 ? k - q_1 : k) + 1;
+}
+
+/**
+ * @brief Add two elements of a Galois field in the Zech logarithm representation.
+ *
+ * @details With a = g^i and b = g^j, the sum is g^i (1 + g^(j - i)), where the logarithm of 1 + g^(j - i) is read from the table of the Zech logarithms.
+ *
+ * @param a The identifier of the first element.
+ * @param b The identifier of the second element.
+ * @param field The field, with Zech logarithm tables.
+ *
+ * @return The identifier of the sum, or 0 if the field has no Zech logarithm tables (see fp_poly_init_zech()).
+ */
+uint16_t fp_poly_zech_add(uint16_t a, uint16_t b, fp_field_t *field)
+{
+    if (!field || !field->zech)
     {
-        fp_poly_t *q_tmp, *r_tmp;
-        if (fp_poly_div(&q_tmp, &r_tmp, r1, r2, f)!= FP_POLY_E_SUCCESS)
-        {
-            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "division of polynoms failed");
-            return FP_POLY_E_POLYNOM_MANIPULATION;
-        }
-        if (fp_poly_free(q_tmp) != FP_POLY_E_SUCCESS)
-        {
-            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "free of polynom failed");
-            return FP_POLY_E_POLYNOM_MANIPULATION;
-        }
-        fp_poly_t *mem = r1;
-        r1 = r2;
-        r2 = r_tmp;
-        if (fp_poly_free(mem) != FP_POLY_E_SUCCESS)
-        {
-            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "free of polynom failed");
-            return FP_POLY_E_POLYNOM_MANIPULATION;
-        }
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no Zech logarithm tables");
+        return 0;
     }
-    *res = r1;
-    if (fp_poly_free(r2) != FP_POLY_E_SUCCESS)
+    if (a == 0)
+        return b;
+    if (b == 0)
+        return a;
+    size_t q_1 = field->zech->size - 1;
+    size_t d = b >= a ? (size_t) (b - a) : b + q_1 - a;
+    return fp_poly_zech_mul(a, field->zech->zech[d], field);
+}
+
+/**
+ * @brief Compute the inverse of an element of a Galois field in the Zech logarithm representation.
+ *
+ * @param a The identifier of the element.
+ * @param field The field, with Zech logarithm tables.
+ *
+ * @return The identifier of the inverse, or 0 if the element is zero or if the field has no Zech logarithm tables (see fp_poly_init_zech()).
+ */
+uint16_t fp_poly_zech_inv(uint16_t a, fp_field_t *field)
+{
+    if (!field || !field->zech)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "free of polynom failed");
-        return FP_POLY_E_POLYNOM_MANIPULATION;
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no Zech logarithm tables");
+        return 0;
     }
-    return FP_POLY_E_SUCCESS;
+    if (a <= 1)
+        return a;
+    return field->zech->size - a + 1;
 }
 
 /**
- * @brief Compute the extended greatest common divisor of two polynoms.
- * 
- * @param res The polynom which will store the greatest common divisor.
- * @param u The first Bézout coefficient.
- * @param v The second Bézout coefficient.
- * @param p The first polynom.
- * @param q The second polynom.
- * @param f The field in which the operation is performed.
- * 
- * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ * @brief Compute the power of an element of a Galois field in the Zech logarithm representation.
+ *
+ * @param a The identifier of the element.
+ * @param exponent The exponent (a negative exponent gives a power of the inverse).
+ * @param field The field, with Zech logarithm tables.
+ *
+ * @return The identifier of the power (by convention, the power 0 of zero is one, and its negative powers are zero), or 0 if the field has no Zech logarithm tables (see fp_poly_init_zech()).
  */
-fp_poly_error_t fp_poly_gcd_extended(fp_poly_t **res, fp_poly_t **u, fp_poly_t **v, fp_poly_t *p, fp_poly_t *q, fp_field_t *f)
+uint16_t fp_poly_zech_pow(uint16_t a, mpz_t exponent, fp_field_t *field)
 {
-    fp_poly_t *old_r = fp_poly_init_mpz(p->index_coeff, list_copy(p->coeff));
-    fp_poly_t *r = fp_poly_init_mpz(q->index_coeff, list_copy(q->coeff));
-    fp_poly_t *old_s = fp_poly_init_array((uint8_t[]) {1}, 0x1);
-    fp_poly_t *s = fp_poly_init_array((uint8_t[]) {0}, 0x1);
-    fp_poly_t *old_t = fp_poly_init_array((uint8_t[]) {0}, 0x1);
-    fp_poly_t *t = fp_poly_init_array((uint8_t[]) {1}, 0x1);
-    fp_poly_t *quot, *rem, *prov, *tmp;
-    while (!fp_poly_is_zero(r))
-    {
-        fp_poly_div(&quot, &rem, old_r, r, f);
-
-        prov = fp_poly_init_mpz(r->index_coeff, list_copy(r->coeff));
-        fp_poly_mul(&tmp, quot, prov, f);
-        fp_poly_sub(&r, old_r, tmp, f);
-        old_r = prov;
-
-        prov = fp_poly_init_mpz(s->index_coeff, list_copy(s->coeff));
-        fp_poly_mul(&tmp, quot, prov, f);
-        fp_poly_sub(&s, old_s, tmp, f);
-        old_s = prov;
-
-        prov = fp_poly_init_mpz(t->index_coeff, list_copy(t->coeff));
-        fp_poly_mul(&tmp, quot, prov, f);
-        fp_poly_sub(&t, old_t, tmp, f);
-        old_t = prov;
-    }
-    // custom error handling: sometimes, a "+0" is kept at the end of the polynom
-    // thus raising an error concerning the expected index of coeff during the unit test
-    if (old_s->coeff->head->coeff == 0)
-    {
-        list_remove_head(old_s->coeff);
-        mpz_clrbit(old_s->index_coeff, 0);
-    }
-    *res = old_r;
-    *u = old_s;
-    *v = old_t;
-    fp_poly_free(r);
-    fp_poly_free(s);
-    fp_poly_free(t);
-    return FP_POLY_E_SUCCESS;
+    if (!field || !field->zech)
+    {
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the field has no Zech logarithm tables");
+        return 0;
+    }
+    if (a == 0)
+        return mpz_sgn(exponent) == 0;
+    size_t q_1 = field->zech->size - 1;
+    uint64_t k = (uint64_t) (a - 1) * mpz_fdiv_ui(exponent, q_1) % q_1;
+    return k + 1;
 }
 
 /**
@@ -1075,11 +4712,12 @@ fp_poly_t *fp_poly_init_mpz(mpz_t pos_coeff, list_t *coeff)
         fp_poly_error(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__, "");
         return NULL;
     }
-    if (fp_poly_count_set_bits(mpz_get_ui(pos_coeff)) != coeff->size)
+    if (mpz_popcount(pos_coeff) != coeff->size)
     {
         char buffer[150];
-        snprintf(buffer, 150, "the number of coefficients in the list and the index of the coefficients are not consistent: number of coefficients is %ld but index of coeff is %ld", coeff->size, fp_poly_count_set_bits(mpz_get_ui(pos_coeff)));
+        snprintf(buffer, 150, "the number of coefficients in the list and the index of the coefficients are not consistent: number of coefficients is %ld but index of coeff is %ld", coeff->size, (size_t) mpz_popcount(pos_coeff));
         fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, buffer);
+        free(res);
         return NULL;
     }
     mpz_init_set(res->index_coeff, pos_coeff);
@@ -1138,65 +4776,162 @@ fp_poly_t *fp_poly_init_array(uint8_t *coeff, size_t len)
 }
 
 /**
- * @brief Auxiliary function to check the irreducibility of a polynom within a field (create the polynom x^n - x).
- * 
- * @details This function returns the polynom x^n - x.
- * 
- * @param n The degree.
- * @param f The field.
- * 
- * @return The polynom.
+ * @brief Check whether the difference of a dense polynom and x is coprime with a prepared modulus.
+ *
+ * @param h The dense polynom (n coefficients, where n is the degree of the modulus).
+ * @param x The dense polynom x reduced modulo the modulus (n coefficients).
+ * @param diff A scratch dense array of n coefficients, which will store h - x.
+ * @param field The field holding the prepared modulus.
+ *
+ * @return A boolean value: 1 if gcd(h - x, f) = 1, 0 otherwise (or if an error occured).
  */
-static fp_poly_t *fp_poly_is_irreducible_aux(uint64_t n, fp_field_t *f)
+static uint8_t fp_poly_is_irreducible_coprime(const uint8_t *h, const uint8_t *x, uint8_t *diff, fp_field_t *field)
 {
-    mpz_t deg_x_n_minux_x;
-    mpz_init_set_ui(deg_x_n_minux_x, 0x0);
-    mpz_setbit(deg_x_n_minux_x, n-1);
-    mpz_setbit(deg_x_n_minux_x, 0);
-    list_t *list = list_init();
-    list_add_beginning(list, 1);
-    list_add_beginning(list, f->order - 1);
-    fp_poly_t *x_n_minux_x = fp_poly_init_mpz(deg_x_n_minux_x, list);
-    return x_n_minux_x;
+    fp_modulus_t *modulus = field->modulus;
+    size_t n = modulus->degree;
+    fp_poly_dense_t a = {n, diff}, b = {n + 1, modulus->coeff}, g;
+    for (size_t i = 0; i < n; i++)
+        a.coeff[i] = (h[i] + field->order - x[i]) % field->order;
+    fp_poly_dense_normalise(&a);
+    if (fp_poly_dense_gcd(&g, NULL, NULL, &b, &a, field) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_dense_gcd() failed");
+        return 0;
+    }
+    uint8_t is_coprime = g.len == 1;
+    fp_poly_dense_clear(&g);
+    return is_coprime;
 }
 
 /**
- * @brief Check if a polynom is irreducible within a field.
- * 
+ * @brief Auxiliary function to check the irreducibility of a polynom within a field.
+ *
+ * @details The powers x^(q^i) mod f are computed one after the other by raising the previous one to the power q (see fp_poly_modulus_powmod()), on a modulus prepared once for f. <br>
+ * With the Rabin test, the prime factors of n are found once by trial division, a greatest common divisor is only computed at the maximal divisors n / r, and the test ends with x^(q^n) = x modulo f. <br>
+ * Since all the n steps are run, the q-th powers are then computed with the Frobenius matrix of f when q > 2 (see fp_poly_modulus_frobenius()). <br>
+ * With the Ben-Or test, gcd(x^(q^i) - x, f) is computed for i = 1, ..., n / 2, so that a polynom with a factor of degree d is rejected after d steps.
+ *
  * @param p The polynom.
  * @param f The field.
- * 
+ * @param is_ben_or A boolean value: 1 to run the Ben-Or test, 0 to run the Rabin test.
+ *
  * @return A boolean value: 1 if the polynom is irreducible, 0 otherwise.
  */
-uint8_t fp_poly_is_irreducible(fp_poly_t *p, fp_field_t *f)
+static uint8_t fp_poly_is_irreducible_aux(fp_poly_t *p, fp_field_t *f, uint8_t is_ben_or)
 {
-    fp_poly_t *x_n_minus_x, *q, *r, *res_gcd;
-    x_n_minus_x = fp_poly_is_irreducible_aux(my_pow(f->order, fp_poly_degree(p)), f);
-    if (fp_poly_div(&q, &r, x_n_minus_x, p, f) != FP_POLY_E_SUCCESS)
+    if (!p)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return 0;
+    }
+    if (!f)
     {
-        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_div() failed");
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
         return 0;
     }
-    if (!fp_poly_is_zero(r))
+    size_t n = fp_poly_degree(p);
+    if (n == 0)
         return 0;
-    for (size_t i = 0; i < fp_poly_degree(p); i++)
+    if (n == 1)
+        return fp_poly_inv(fp_poly_degree_to_node_list(p, 1)->coeff % f->order, f) != 0;
+    // the steps at which a greatest common divisor is computed, in increasing order
+    size_t divisors[8 * sizeof(size_t)], nb_divisors = 0, last_step = n / 2;
+    if (!is_ben_or)
     {
-        if (is_prime(i, 15))
+        size_t factors[8 * sizeof(size_t)], nb_factors = 0, m = n;
+        for (size_t r = 2; r * r <= m; r++)
         {
-            if (fp_poly_degree(p) % i == 0)
-            {
-                x_n_minus_x = fp_poly_is_irreducible_aux(i, f);
-                if (fp_poly_gcd(&res_gcd, x_n_minus_x, p, f) != FP_POLY_E_SUCCESS)
-                {
-                    fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_gcd() failed");
-                    return 0;
-                }
-                if (!fp_poly_is_unit(res_gcd))
-                    return 0;
-            }
+            if (m % r != 0)
+                continue;
+            factors[nb_factors++] = r;
+            while (m % r == 0)
+                m /= r;
         }
+        if (m > 1)
+            factors[nb_factors++] = m;
+        for (size_t i = nb_factors; i > 0; i--)
+            divisors[nb_divisors++] = n / factors[i - 1];
+        last_step = n;
     }
-    return 1;
+    fp_modulus_t *modulus = fp_poly_modulus_init(p, f);
+    if (!modulus)
+        return 0;
+    // the field defined by p, which shares the inverse table of f
+    fp_field_t field = {.order = f->order, .irreducible_polynom = p, .modulus = modulus, .frobenius = NULL, .inverse = f->inverse, .zech = NULL};
+    uint8_t *buffer = (uint8_t *) malloc(4 * n);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        fp_poly_modulus_free(field.modulus);
+        return 0;
+    }
+    uint8_t *x = buffer, *h = buffer + n, *tmp = buffer + 2 * n, *diff = buffer + 3 * n;
+    memset(x, 0, n);
+    x[1] = 1;
+    memcpy(h, x, n);
+    mpz_t q;
+    mpz_init_set_ui(q, f->order);
+    uint8_t is_irreducible = 1;
+    size_t next_divisor = 0;
+    // the Rabin test runs all the n steps, so the Frobenius matrix pays off as soon as a q-th power is more than a squaring
+    uint8_t use_frobenius = !is_ben_or && f->order > 2 && fp_poly_init_frobenius(&field) == FP_POLY_E_SUCCESS;
+    for (size_t i = 1; i <= last_step && is_irreducible; i++)
+    {
+        // h = x^(q^i) mod f
+        if ((use_frobenius ? fp_poly_modulus_frobenius(tmp, h, &field) : fp_poly_modulus_powmod(tmp, h, q, &field)) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the q-th power failed");
+            is_irreducible = 0;
+            break;
+        }
+        memcpy(h, tmp, n);
+        if (is_ben_or)
+            is_irreducible = fp_poly_is_irreducible_coprime(h, x, diff, &field);
+        else if (next_divisor < nb_divisors && i == divisors[next_divisor])
+        {
+            is_irreducible = fp_poly_is_irreducible_coprime(h, x, diff, &field);
+            next_divisor++;
+        }
+    }
+    if (is_irreducible && !is_ben_or)
+        is_irreducible = memcmp(h, x, n) == 0;
+    mpz_clear(q);
+    free(buffer);
+    fp_poly_modulus_free(field.modulus);
+    free(field.frobenius);
+    return is_irreducible;
+}
+
+/**
+ * @brief Check if a polynom is irreducible within a field.
+ *
+ * @details The Rabin test is used: a polynom f of degree n over F_q is irreducible if and only if x^(q^n) = x modulo f and gcd(x^(q^(n / r)) - x, f) = 1 for every prime factor r of n. <br>
+ * Only a few greatest common divisors are computed, so this test has the best worst case (see fp_poly_is_irreducible_aux()).
+ *
+ * @param p The polynom.
+ * @param f The field.
+ *
+ * @return A boolean value: 1 if the polynom is irreducible, 0 otherwise.
+ */
+uint8_t fp_poly_is_irreducible(fp_poly_t *p, fp_field_t *f)
+{
+    return fp_poly_is_irreducible_aux(p, f, 0);
+}
+
+/**
+ * @brief Check if a polynom is irreducible within a field with an early abort.
+ *
+ * @details The Ben-Or test is used: a polynom f of degree n over F_q is irreducible if and only if gcd(x^(q^i) - x, f) = 1 for i = 1, ..., n / 2. <br>
+ * Since the steps are run in increasing order, a polynom with a factor of small degree is rejected after a few steps, which makes this test faster on average for random polynoms (see fp_poly_is_irreducible_aux()).
+ *
+ * @param p The polynom.
+ * @param f The field.
+ *
+ * @return A boolean value: 1 if the polynom is irreducible, 0 otherwise.
+ */
+uint8_t fp_poly_is_irreducible_ben_or(fp_poly_t *p, fp_field_t *f)
+{
+    return fp_poly_is_irreducible_aux(p, f, 1);
 }
 
 /**
@@ -1242,42 +4977,177 @@ fp_poly_t *fp_poly_init_random(size_t degree, fp_field_t *f)
     return res;
 }
 
+/**
+ * @brief Draw the next number of a splitmix64 generator.
+ *
+ * @param state The state of the generator (updated).
+ *
+ * @return A pseudo-random 64-bit number.
+ */
+static uint64_t fp_poly_random_next(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Check whether a dense polynom has a root in a prime field.
+ *
+ * @details The root 0 is excluded by a non zero constant coefficient, and the other elements are tried one after the other with the Horner method.
+ *
+ * @param a The dense polynom.
+ * @param len The length of the dense polynom.
+ * @param order The order of the field.
+ *
+ * @return A boolean value: 1 if the polynom has a root, 0 otherwise.
+ */
+static uint8_t fp_poly_dense_has_root(const uint8_t *a, size_t len, uint8_t order)
+{
+    if (a[0] == 0)
+        return 1;
+    for (uint16_t point = 1; point < order; point++)
+    {
+        uint16_t value = 0;
+        for (size_t i = len; i > 0; i--)
+            value = (value * point + a[i - 1]) % order;
+        if (value == 0)
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Build the product of the polynoms x^(p^d) - x for k / 2 < d <= k.
+ *
+ * @details Every irreducible polynom of degree e <= k divides x^(p^d) - x for the multiple d of e in ]k / 2, k], and every factor of the product has a degree at most k. <br>
+ * Hence, a polynom is coprime with this product if and only if it has no factor of degree at most k, which is checked with a single greatest common divisor.
+ *
+ * @param res The dense polynom which will store the product (must be uninitialized).
+ * @param k The maximal degree of the factors.
+ * @param order The order of the field.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_poly_dense_small_factors(fp_poly_dense_t *res, size_t k, uint8_t order)
+{
+    if (fp_poly_dense_init(res, 1) != FP_POLY_E_SUCCESS)
+        return FP_POLY_E_MEMORY;
+    res->coeff[0] = 1;
+    size_t power = 1;
+    for (size_t d = 1; d <= k; d++)
+    {
+        power *= order;
+        if (2 * d <= k)
+            continue;
+        fp_poly_dense_t factor, prod;
+        if (fp_poly_dense_init(&factor, power + 1) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_dense_clear(res);
+            return FP_POLY_E_MEMORY;
+        }
+        factor.coeff[1] = order - 1;
+        factor.coeff[power] = 1;
+        if (fp_poly_dense_product(&prod, res, &factor, order) != FP_POLY_E_SUCCESS)
+        {
+            fp_poly_dense_clear(&factor);
+            fp_poly_dense_clear(res);
+            return FP_POLY_E_MEMORY;
+        }
+        fp_poly_dense_clear(&factor);
+        fp_poly_dense_clear(res);
+        *res = prod;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
 /**
  * @brief Initialize a random irreducible polynom of a given degree within a field.
  *
- * @details The <a href="https://en.wikipedia.org/wiki/Cohn%27s_irreducibility_criterion">Cohen's irreducibility criterion</a> is implemented.
+ * @details Monic candidates are drawn with a splitmix64 generator seeded once from /dev/urandom, and sieved before the full test:
+ * - a candidate with a root in the field is rejected (see fp_poly_dense_has_root()),
+ * - a candidate with a factor of degree at most k is rejected by a single greatest common divisor with a product precomputed once (see fp_poly_dense_small_factors()), where k is the largest degree for which this product is not longer than the candidate. <br>
+ * The remaining candidates are checked with the Ben-Or test (see fp_poly_is_irreducible_ben_or()).
  *
- * @param digits The number of digits of the polynom.
- * @param field The field of the polynom.
+ * @param degree The degree of the polynom.
+ * @param field The field of the polynom (a prime field).
  *
  * @return The polynom if the operation was successful or NULL otherwise.
  */
-fp_poly_t *fp_poly_init_random_irreducible(size_t digits, fp_field_t *field)
+fp_poly_t *fp_poly_init_random_irreducible(size_t degree, fp_field_t *field)
 {
-    mpz_t rand;
-    list_t *list = list_init();
-    mpz_init(rand);
-    random_prime_mpz(rand, digits);
-    /*
-    for (size_t i = 0; i < mpz_sizeinbase(rand, 2); i++)
-        if (mpz_tstbit(rand, i))
-            list_add_beginning(list, 1);
-    */
-    char *rand_change_base = mpz_get_str(NULL, field->order, rand);
-    mpz_clear(rand);
-    mpz_t rand_poly;
-    mpz_init(rand_poly);
-    for (size_t i = 0; i < strlen(rand_change_base); i++)
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    if (degree == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "there is no irreducible polynom of degree 0");
+        return NULL;
+    }
+    uint8_t order = field->order;
+    // the product of x^(p^d) - x for k / 2 < d <= k has a degree lower than 2p^k, which is kept below the degree of the candidates
+    size_t k = 0, power = 1;
+    while (2 * (k + 1) <= degree && power * order <= degree / 2)
+    {
+        power *= order;
+        k++;
+    }
+    fp_poly_dense_t small_factors = {0, NULL};
+    if (k >= 2 && fp_poly_dense_small_factors(&small_factors, k, order) != FP_POLY_E_SUCCESS)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return NULL;
+    }
+    uint8_t *coeff = (uint8_t *) malloc(degree + 1);
+    if (!coeff)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        fp_poly_dense_clear(&small_factors);
+        return NULL;
+    }
+    uint64_t state;
+    unsigned char seed[8];
+    read_urandom_full(seed, 8);
+    state = buffer_to_ulong(seed, 8);
+    fp_poly_t *res = NULL;
+    while (!res)
     {
-        if (rand_change_base[i] - '0' != 0)
+        coeff[0] = 1 + fp_poly_random_next(&state) % (order - 1);
+        for (size_t i = 1; i < degree; i++)
+            coeff[i] = fp_poly_random_next(&state) % order;
+        coeff[degree] = 1;
+        if (degree > 1 && fp_poly_dense_has_root(coeff, degree + 1, order))
+            continue;
+        if (small_factors.len != 0)
         {
-            list_add_end(list, rand_change_base[i] - '0');
-            mpz_setbit(rand_poly, i);
+            fp_poly_dense_t candidate = {degree + 1, coeff}, g;
+            if (fp_poly_dense_gcd(&g, NULL, NULL, &small_factors, &candidate, field) != FP_POLY_E_SUCCESS)
+            {
+                fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "fp_poly_dense_gcd() failed");
+                break;
+            }
+            uint8_t is_coprime = g.len == 1;
+            fp_poly_dense_clear(&g);
+            if (!is_coprime)
+                continue;
+        }
+        res = fp_poly_init_array(coeff, degree + 1);
+        if (!res)
+        {
+            fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+            break;
+        }
+        if (!fp_poly_is_irreducible_ben_or(res, field))
+        {
+            fp_poly_free(res);
+            res = NULL;
         }
     }
-    fp_poly_t *res = (fp_poly_t*) malloc(sizeof(fp_poly_t));
-    mpz_init_set(res->index_coeff, rand_poly);
-    res->coeff = list;
+    free(coeff);
+    fp_poly_dense_clear(&small_factors);
     return res;
 }
 
@@ -1544,9 +5414,12 @@ fp_field_t *fp_poly_init_prime_field(uint8_t order)
 
 /**
  * @brief Initialize a Galois Field.
- * 
+ *
+ * @details When an irreducible polynom is given, its prepared modulus is built once (see @ref fp_modulus_t) and reused by every reduction in the field.
+ *
  * @param order The order.
- * 
+ * @param irreducible_polynom The irreducible polynom that defines the field (may be NULL).
+ *
  * @return The field if the operation was successful or NULL otherwise.
 */
 fp_field_t *fp_poly_init_galois_field(uint8_t order, fp_poly_t *irreducible_polynom)
@@ -1565,6 +5438,17 @@ fp_field_t *fp_poly_init_galois_field(uint8_t order, fp_poly_t *irreducible_poly
     // TODO: check that the order must be the degree of the irreducible polynom ? and check that the order is a prime nu;ber or a power of a prime number
     field->order = order;
     field->irreducible_polynom = irreducible_polynom;
+    field->modulus = NULL;
+    field->frobenius = NULL;
+    field->inverse = fp_poly_inverse_table_init(order);
+    if (!field->inverse)
+    {
+        free(field);
+        return NULL;
+    }
+    field->zech = NULL;
+    if (irreducible_polynom)
+        field->modulus = fp_poly_modulus_init(irreducible_polynom, field);
     return field;
 }
 
@@ -1590,6 +5474,11 @@ fp_poly_error_t fp_poly_free_field(fp_field_t *field)
             return FP_POLY_E_POLYNOM_MANIPULATION;
         }
     }
+    if (field->modulus)
+        fp_poly_modulus_free(field->modulus);
+    free(field->frobenius);
+    free(field->inverse);
+    fp_poly_zech_free(field->zech);
     free(field);
     return FP_POLY_E_SUCCESS;
 }
\ No newline at end of file
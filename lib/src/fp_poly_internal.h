@@ -0,0 +1,21 @@
+/**
+ * @file fp_poly_internal.h
+ * @brief Header of the functions of fp_poly.c shared with the other modules of the library (not part of the public interface).
+ * @author Guillaume Roumage
+ * @date 04/2024
+*/
+
+#ifndef FP_POLY_INTERNAL_H
+#define FP_POLY_INTERNAL_H
+
+#include "../include/fp_poly.h"
+
+void fp_poly_error(fp_poly_error_t, const char *, const char *, const int, const char *);
+void fp_poly_error_no_custom_msg(fp_poly_error_t, const char *, const char *, const int);
+
+// dense kernels without argument checks (see fp_poly_mullow(), fp_poly_mulhigh() and fp_poly_mulmid() for the public interface)
+void fp_poly_dense_mullow(uint8_t *, const uint8_t *, size_t, const uint8_t *, size_t, size_t, uint8_t);
+void fp_poly_dense_mulmid(uint8_t *, const uint8_t *, const uint8_t *, size_t, uint8_t);
+fp_poly_error_t fp_poly_dense_inv_series(uint8_t *, const uint8_t *, size_t, size_t, fp_field_t *);
+
+#endif //FP_POLY_INTERNAL_H
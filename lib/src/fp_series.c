@@ -0,0 +1,286 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../include/fp_series.h"
+#include "fp_poly_internal.h"
+
+/**
+ * @brief Check the arguments of an operation on series and write the series into a dense array of n coefficients.
+ *
+ * @param dense The parameter which will store the dense array (n coefficients, followed by \p extra free coefficients).
+ * @param a The series.
+ * @param n The precision.
+ * @param extra The number of free coefficients after the series.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_series_to_dense(uint8_t **dense, fp_poly_t *a, size_t n, size_t extra, fp_field_t *field)
+{
+    if (!a)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_POLYNOM_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_POLYNOM_IS_NULL;
+    }
+    if (!field)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_FIELD_IS_NULL, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_FIELD_IS_NULL;
+    }
+    if (n == 0)
+    {
+        fp_poly_error(FP_POLY_E_POLYNOM_MANIPULATION, __FILE__, __func__, __LINE__, "the precision is zero");
+        return FP_POLY_E_POLYNOM_MANIPULATION;
+    }
+    *dense = (uint8_t *) calloc(n + extra, 1);
+    if (!*dense)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    size_t degree = 0;
+    for (list_node_t *node = a->coeff->head; node != NULL; node = node->next, degree++)
+    {
+        degree = mpz_scan1(a->index_coeff, degree);
+        if (degree >= n)
+            break;
+        (*dense)[degree] = node->coeff % field->order;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Create a polynom from a dense series and free the dense array.
+ *
+ * @param res The polynom which will store the series.
+ * @param buffer The buffer to free.
+ * @param dense The dense series (inside \p buffer).
+ * @param n The precision.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_series_from_dense(fp_poly_t **res, uint8_t *buffer, uint8_t *dense, size_t n)
+{
+    *res = fp_poly_init_array(dense, n);
+    free(buffer);
+    if (!*res)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the logarithm of a dense series whose constant coefficient is one, i.e., the integral of a' / a.
+ *
+ * @param res The dense array which will store the logarithm (n coefficients, must not overlap \p a).
+ * @param a The dense series (n coefficients).
+ * @param n The precision (at most the order of the field).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+static fp_poly_error_t fp_series_dense_log(uint8_t *res, const uint8_t *a, size_t n, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    res[0] = 0;
+    if (n == 1)
+        return FP_POLY_E_SUCCESS;
+    uint8_t *buffer = (uint8_t *) malloc(3 * n);
+    if (!buffer)
+    {
+        fp_poly_error_no_custom_msg(FP_POLY_E_MEMORY, __FILE__, __func__, __LINE__);
+        return FP_POLY_E_MEMORY;
+    }
+    uint8_t *derivative = buffer, *inv = buffer + n, *quotient = buffer + 2 * n;
+    for (size_t k = 1; k < n; k++)
+        derivative[k - 1] = (uint16_t) a[k] * (k % order) % order;
+    if (fp_poly_dense_inv_series(inv, a, n - 1, n - 1, field) != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return FP_POLY_E_MEMORY;
+    }
+    fp_poly_dense_mullow(quotient, derivative, n - 1, inv, n - 1, n - 1, order);
+    for (size_t k = 1; k < n; k++)
+        res[k] = (uint16_t) quotient[k - 1] * fp_poly_inv(k, field) % order;
+    free(buffer);
+    return FP_POLY_E_SUCCESS;
+}
+
+/**
+ * @brief Compute the inverse of a series.
+ *
+ * @details The inverse is computed with the Newton iteration g <- g - g (a g - 1) of fp_poly_dense_inv_series(), whose error term is a middle product and whose correction is a low product, so that it costs O(M(n)) operations.
+ *
+ * @param res The polynom which will store 1 / a mod x^n.
+ * @param a The series (its constant coefficient must be non zero).
+ * @param n The precision.
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_series_inv(fp_poly_t **res, fp_poly_t *a, size_t n, fp_field_t *field)
+{
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_series_to_dense(&buffer, a, n, n, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    if (buffer[0] == 0)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the constant coefficient is zero");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    if ((err = fp_poly_dense_inv_series(buffer + n, buffer, n, n, field)) != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    return fp_series_from_dense(res, buffer, buffer + n, n);
+}
+
+/**
+ * @brief Compute the square root of a series over a field of odd characteristic.
+ *
+ * @details The inverse square root y is computed with the Newton iteration y <- y + y (1 - a y^2) / 2, which doubles the precision at each step with low products only, and the square root is a y. <br>
+ * The square root of the constant coefficient is found by an exhaustive search in the prime field, and the result is the series whose constant coefficient is the smallest of the two roots.
+ *
+ * @param res The polynom which will store a square root of a mod x^n.
+ * @param a The series (its constant coefficient must be a non zero square).
+ * @param n The precision.
+ * @param field The field in which the operation is performed (of odd order).
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_series_sqrt(fp_poly_t **res, fp_poly_t *a, size_t n, fp_field_t *field)
+{
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_series_to_dense(&buffer, a, n, 4 * n, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    uint8_t order = field->order;
+    if (order == 2)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the characteristic of the field is 2");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    uint16_t root = 1;
+    while (root < order && root * root % order != buffer[0])
+        root++;
+    if (root == order)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the constant coefficient is not a non zero square");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    uint8_t *dense = buffer, *y = buffer + n, *square = y + n, *error = square + n, *correction = error + n;
+    uint16_t half = fp_poly_inv(2, field);
+    y[0] = fp_poly_inv(root, field);
+    for (size_t l = 1; l < n;)
+    {
+        size_t l2 = 2 * l < n ? 2 * l : n, len_t = l2 - l;
+        // a y^2 = 1 - x^l t mod x^l2, then y <- y + x^l (y t / 2) mod x^l2
+        fp_poly_dense_mullow(square, y, l, y, l, l2, order);
+        fp_poly_dense_mullow(error, dense, l2, square, l2, l2, order);
+        for (size_t i = 0; i < len_t; i++)
+            error[l + i] = (order - error[l + i]) % order;
+        fp_poly_dense_mullow(correction, y, l, error + l, len_t, len_t, order);
+        for (size_t i = 0; i < len_t; i++)
+            y[l + i] = correction[i] * half % order;
+        l = l2;
+    }
+    fp_poly_dense_mullow(square, dense, n, y, n, n, order);
+    return fp_series_from_dense(res, buffer, square, n);
+}
+
+/**
+ * @brief Compute the logarithm of a series, when the characteristic of the field is at least the precision.
+ *
+ * @details The logarithm is the integral of a' / a, where the inverse of a is computed by fp_poly_dense_inv_series() and the quotient is a low product, so that it costs O(M(n)) operations. <br>
+ * The integration divides the coefficient of degree k - 1 by k for k < n, which requires n <= p.
+ *
+ * @param res The polynom which will store log(a) mod x^n.
+ * @param a The series (its constant coefficient must be one).
+ * @param n The precision (at most the order of the field).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_series_log(fp_poly_t **res, fp_poly_t *a, size_t n, fp_field_t *field)
+{
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_series_to_dense(&buffer, a, n, n, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    if (n > field->order)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the precision is larger than the characteristic of the field");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    if (buffer[0] != 1)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the constant coefficient is not one");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    if ((err = fp_series_dense_log(buffer + n, buffer, n, field)) != FP_POLY_E_SUCCESS)
+    {
+        free(buffer);
+        return err;
+    }
+    return fp_series_from_dense(res, buffer, buffer + n, n);
+}
+
+/**
+ * @brief Compute the exponential of a series, when the characteristic of the field is at least the precision.
+ *
+ * @details The exponential is computed with the Newton iteration g <- g (1 + a - log(g)), which doubles the precision at each step. Each step costs a logarithm and a low product, so that the whole exponential costs O(M(n)) operations.
+ *
+ * @param res The polynom which will store exp(a) mod x^n.
+ * @param a The series (its constant coefficient must be zero).
+ * @param n The precision (at most the order of the field).
+ * @param field The field in which the operation is performed.
+ *
+ * @return FP_POLY_E_SUCCESS if the operation was successful or an error code otherwise (see @ref fp_poly_error_t for the list of error codes).
+ */
+fp_poly_error_t fp_series_exp(fp_poly_t **res, fp_poly_t *a, size_t n, fp_field_t *field)
+{
+    uint8_t *buffer;
+    fp_poly_error_t err = fp_series_to_dense(&buffer, a, n, 3 * n, field);
+    if (err != FP_POLY_E_SUCCESS)
+        return err;
+    uint8_t order = field->order;
+    if (n > order)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_FIELD_MANIPULATION, __FILE__, __func__, __LINE__, "the precision is larger than the characteristic of the field");
+        return FP_POLY_E_FIELD_MANIPULATION;
+    }
+    if (buffer[0] != 0)
+    {
+        free(buffer);
+        fp_poly_error(FP_POLY_E_COEFFICIENT_ARITHMETIC, __FILE__, __func__, __LINE__, "the constant coefficient is not zero");
+        return FP_POLY_E_COEFFICIENT_ARITHMETIC;
+    }
+    uint8_t *dense = buffer, *g = buffer + n, *log = g + n, *correction = log + n;
+    g[0] = 1;
+    for (size_t l = 1; l < n;)
+    {
+        size_t l2 = 2 * l < n ? 2 * l : n, len_t = l2 - l;
+        // log(g) = a mod x^l, then g <- g + x^l (g t) mod x^l2 with t = (a - log(g)) / x^l
+        memset(g + l, 0, len_t);
+        if ((err = fp_series_dense_log(log, g, l2, field)) != FP_POLY_E_SUCCESS)
+        {
+            free(buffer);
+            return err;
+        }
+        for (size_t i = l; i < l2; i++)
+            log[i] = (dense[i] + order - log[i]) % order;
+        fp_poly_dense_mullow(correction, g, l, log + l, len_t, len_t, order);
+        memcpy(g + l, correction, len_t);
+        l = l2;
+    }
+    return fp_series_from_dense(res, buffer, g, n);
+}
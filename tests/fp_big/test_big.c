@@ -0,0 +1,173 @@
+#include <stdlib.h>
+#include "../../lib/include/fp_big.h"
+
+static fp_big_poly_t *random_poly(mpz_t *coeff, size_t len, gmp_randstate_t state, fp_big_field_t *field)
+{
+    for (size_t i = 0; i < len; i++)
+        mpz_urandomm(coeff[i], state, field->order);
+    if (len)
+        mpz_set_ui(coeff[len - 1], 1 + gmp_urandomm_ui(state, 1000));
+    return fp_big_poly_init_mpz_array(coeff, len, field);
+}
+
+static void assert_coeffs(fp_big_poly_t *p, mpz_t *expected, size_t len, fp_big_field_t *field)
+{
+    mpz_t c;
+    mpz_init(c);
+    for (size_t i = 0; i < len; i++)
+    {
+        assert (fp_big_poly_get_coeff(c, p, i, field) == FP_POLY_E_SUCCESS);
+        assert (mpz_cmp(c, expected[i]) == 0);
+    }
+    mpz_clear(c);
+}
+
+static void assert_field(const char *order, gmp_randstate_t state)
+{
+    mpz_t p;
+    mpz_init_set_str(p, order, 10);
+    fp_big_field_t *field = fp_big_init_field(p);
+    assert (field != NULL);
+    mpz_t a[20], b[20], expected[40], c;
+    for (size_t i = 0; i < 20; i++)
+    {
+        mpz_init(a[i]);
+        mpz_init(b[i]);
+    }
+    for (size_t i = 0; i < 40; i++)
+        mpz_init(expected[i]);
+    mpz_init(c);
+    for (size_t t = 0; t < 10; t++)
+    {
+        size_t len_a = 1 + t * 2, len_b = 1 + (t * 7) % 20;
+        fp_big_poly_t *pa = random_poly(a, len_a, state, field), *pb = random_poly(b, len_b, state, field), *res, *quot, *rem, *tmp;
+
+        // the product matches the schoolbook product on mpz_t numbers
+        for (size_t k = 0; k < len_a + len_b - 1; k++)
+            mpz_set_ui(expected[k], 0);
+        for (size_t i = 0; i < len_a; i++)
+            for (size_t j = 0; j < len_b; j++)
+                mpz_addmul(expected[i + j], a[i], b[j]);
+        for (size_t k = 0; k < len_a + len_b - 1; k++)
+            mpz_mod(expected[k], expected[k], p);
+        assert (fp_big_poly_mul(&res, pa, pb, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_degree(res) == len_a + len_b - 2);
+        assert_coeffs(res, expected, len_a + len_b - 1, field);
+
+        // (a b) / b = a, and a = q b + r with deg r < deg b
+        assert (fp_big_poly_div(&quot, &rem, res, pb, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_equal(quot, pa, field));
+        assert (fp_big_poly_is_zero(rem));
+        assert (fp_big_poly_free(quot) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(rem) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_div(&quot, &rem, pa, pb, field) == FP_POLY_E_SUCCESS);
+        assert (rem->len < pb->len);
+        assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_mul(&tmp, quot, pb, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_add(&res, tmp, rem, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_equal(res, pa, field));
+        assert (fp_big_poly_free(tmp) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(quot) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(rem) == FP_POLY_E_SUCCESS);
+
+        // (a + b) - b = a, and a - a = 0
+        assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_add(&tmp, pa, pb, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_sub(&res, tmp, pb, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_equal(res, pa, field));
+        assert (fp_big_poly_free(tmp) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_sub(&res, pa, pa, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_is_zero(res));
+        assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+
+        // gcd(a g, b g) is the monic g (a and b are coprime with a high probability)
+        fp_big_poly_t *g = random_poly(expected, 4, state, field), *ag, *bg;
+        assert (fp_big_poly_mul(&ag, pa, g, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_mul(&bg, pb, g, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_gcd(&res, ag, bg, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_degree(res) == 3);
+        assert (fp_big_poly_get_coeff(c, res, 3, field) == FP_POLY_E_SUCCESS);
+        assert (mpz_cmp_ui(c, 1) == 0);
+        assert (fp_big_poly_div(&quot, &rem, g, res, field) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_is_zero(rem));
+        assert (fp_big_poly_free(quot) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(rem) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(ag) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(bg) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(g) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(pa) == FP_POLY_E_SUCCESS);
+        assert (fp_big_poly_free(pb) == FP_POLY_E_SUCCESS);
+    }
+    for (size_t i = 0; i < 20; i++)
+    {
+        mpz_clear(a[i]);
+        mpz_clear(b[i]);
+    }
+    for (size_t i = 0; i < 40; i++)
+        mpz_clear(expected[i]);
+    mpz_clear(c);
+    mpz_clear(p);
+    assert (fp_big_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    // over F_7, (3 + 2x) (1 + x) = 3 + 5x + 2x^2
+    mpz_t p, coeff[3];
+    mpz_init_set_ui(p, 7);
+    for (size_t i = 0; i < 3; i++)
+        mpz_init(coeff[i]);
+    fp_big_field_t *field = fp_big_init_field(p);
+    mpz_set_ui(coeff[0], 3);
+    mpz_set_si(coeff[1], -5);
+    fp_big_poly_t *a = fp_big_poly_init_mpz_array(coeff, 2, field);
+    mpz_set_ui(coeff[0], 1);
+    mpz_set_ui(coeff[1], 1);
+    fp_big_poly_t *b = fp_big_poly_init_mpz_array(coeff, 2, field), *res;
+    assert (fp_big_poly_mul(&res, a, b, field) == FP_POLY_E_SUCCESS);
+    mpz_set_ui(coeff[0], 3);
+    mpz_set_ui(coeff[1], 5);
+    mpz_set_ui(coeff[2], 2);
+    assert_coeffs(res, coeff, 3, field);
+    assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+    fp_big_poly_t *quot, *rem, *zero = fp_big_poly_init_mpz_array(coeff, 0, field);
+    assert (fp_big_poly_is_zero(zero));
+    assert (fp_big_poly_div(&quot, &rem, a, zero, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_big_poly_mul(&res, a, zero, field) == FP_POLY_E_SUCCESS);
+    assert (fp_big_poly_is_zero(res));
+    assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_big_poly_gcd(&res, zero, zero, field) == FP_POLY_E_SUCCESS);
+    assert (fp_big_poly_is_zero(res));
+    assert (fp_big_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_big_poly_add(&res, NULL, a, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_big_poly_free(zero) == FP_POLY_E_SUCCESS);
+    assert (fp_big_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_big_poly_free(b) == FP_POLY_E_SUCCESS);
+    assert (fp_big_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // the order must be an odd prime number
+    mpz_set_ui(p, 2);
+    assert (fp_big_init_field(p) == NULL);
+    mpz_set_ui(p, 15);
+    assert (fp_big_init_field(p) == NULL);
+    mpz_clear(p);
+    for (size_t i = 0; i < 3; i++)
+        mpz_clear(coeff[i]);
+
+    // one limb, 2^255 - 19 and the 521-bit Mersenne prime
+    gmp_randstate_t state;
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, 42);
+    assert_field("18446744073709551557", state);
+    assert_field("57896044618658097711785492504343953926634992332820282019728792003956564819949", state);
+    assert_field("6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151", state);
+    gmp_randclear(state);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include "../../lib/include/fp_fq.h"
+
+static void assert_fixed_base(size_t window, fp_field_t *field, gmp_randstate_t state)
+{
+    fp_fq_elem_t g, expected, res;
+    do
+    {
+        for (size_t k = 0; k < field->modulus->degree; k++)
+            g.coeff[k] = rand() % field->order;
+    } while (fp_fq_is_zero(&g, field));
+    fp_fq_fixed_base_t *t = fp_fq_fixed_base_init(&g, window, field);
+    assert (t != NULL);
+    mpz_t e;
+    mpz_init(e);
+    for (size_t i = 0; i < 20; i++)
+    {
+        // exponents up to a few times the order of the group, possibly negative
+        mpz_urandomb(e, state, mpz_sizeinbase(t->group_order, 2) + 3);
+        if (i % 3 == 0)
+            mpz_neg(e, e);
+        if (i == 0)
+            mpz_set_ui(e, 0);
+        if (i == 1)
+            mpz_set(e, t->group_order);
+        assert (fp_fq_pow(&expected, &g, e, field) == FP_POLY_E_SUCCESS);
+        assert (fp_fq_fixed_base_pow(&res, t, e, field) == FP_POLY_E_SUCCESS);
+        assert (fp_fq_equal(&expected, &res, field));
+    }
+    mpz_clear(e);
+    assert (fp_fq_fixed_base_free(t) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3): the table of x with w = 2 is [x, x^2, x^3, x^4, x^8, x^12]
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    fp_fq_elem_t g = {{0, 1, 0}}, res;
+    fp_fq_fixed_base_t *t = fp_fq_fixed_base_init(&g, 2, field);
+    assert (t != NULL && t->digits == 2);
+    assert (mpz_cmp_ui(t->group_order, 7) == 0);
+    mpz_t e;
+    mpz_init_set_ui(e, 3);
+    assert (fp_fq_fixed_base_pow(&res, t, e, field) == FP_POLY_E_SUCCESS);
+    assert (res.coeff[0] == 1 && res.coeff[1] == 1 && res.coeff[2] == 0);
+    mpz_set_si(e, -1);
+    assert (fp_fq_fixed_base_pow(&res, t, e, field) == FP_POLY_E_SUCCESS);
+    assert (res.coeff[0] == 1 && res.coeff[1] == 0 && res.coeff[2] == 1);
+    mpz_clear(e);
+    assert (fp_fq_fixed_base_free(t) == FP_POLY_E_SUCCESS);
+    fp_fq_zero(&g, field);
+    assert (fp_fq_fixed_base_init(&g, 2, field) == NULL);
+    g.coeff[0] = 1;
+    assert (fp_fq_fixed_base_init(&g, 9, field) == NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random bases and windows
+    gmp_randstate_t state;
+    gmp_randinit_default(state);
+    uint8_t orders[] = {2, 3, 251};
+    size_t degrees[] = {1, 7, 64};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+        for (size_t j = 0; j < sizeof(degrees) / sizeof(degrees[0]); j++)
+        {
+            field = fp_poly_init_prime_field(orders[i]);
+            fp_poly_t *irreducible = fp_poly_init_random_irreducible(degrees[j], field);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+            field = fp_poly_init_galois_field(orders[i], irreducible);
+            assert_fixed_base(0, field, state);
+            assert_fixed_base(1, field, state);
+            assert_fixed_base(7, field, state);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+        }
+    gmp_randclear(state);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
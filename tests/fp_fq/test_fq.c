@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include "../../lib/include/fp_fq.h"
+
+static void random_elem(fp_fq_elem_t *res, fp_field_t *field)
+{
+    for (size_t i = 0; i < field->modulus->degree; i++)
+        res->coeff[i] = rand() % field->order;
+}
+
+static void assert_elem_equality(fp_poly_t *expected, const fp_fq_elem_t *a, fp_field_t *field)
+{
+    fp_poly_t *p;
+    assert (fp_fq_to_poly(&p, a, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(expected, p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+}
+
+static void assert_fq_field(fp_field_t *field)
+{
+    mpz_t e;
+    mpz_init(e);
+    fp_fq_elem_t a[8], b[8], c[8];
+    for (size_t t = 0; t < 8; t++)
+    {
+        random_elem(&a[t], field);
+        random_elem(&b[t], field);
+    }
+    for (size_t t = 0; t < 8; t++)
+    {
+        fp_poly_t *p_a, *p_b, *expected;
+        assert (fp_fq_to_poly(&p_a, &a[t], field) == FP_POLY_E_SUCCESS);
+        assert (fp_fq_to_poly(&p_b, &b[t], field) == FP_POLY_E_SUCCESS);
+
+        // the product and the square match fp_poly_mul_fq()
+        fp_fq_mul(&c[t], &a[t], &b[t], field);
+        assert (fp_poly_mul_fq(&expected, p_a, p_b, field) == FP_POLY_E_SUCCESS);
+        assert_elem_equality(expected, &c[t], field);
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        fp_fq_sqr(&c[t], &a[t], field);
+        assert (fp_poly_mul_fq(&expected, p_a, p_a, field) == FP_POLY_E_SUCCESS);
+        assert_elem_equality(expected, &c[t], field);
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+
+        // a + b - b = a
+        fp_fq_add(&c[t], &a[t], &b[t], field);
+        fp_fq_sub(&c[t], &c[t], &b[t], field);
+        assert (fp_fq_equal(&c[t], &a[t], field));
+
+        // the inverse and the powers match fp_poly_invmod() and fp_poly_powmod()
+        if (!fp_fq_is_zero(&a[t], field))
+        {
+            assert (fp_fq_inv(&c[t], &a[t], field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_invmod(&expected, p_a, field) == FP_POLY_E_SUCCESS);
+            assert_elem_equality(expected, &c[t], field);
+            assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+            mpz_set_si(e, (long) (rand() % 2000) - 1000);
+            assert (fp_fq_pow(&c[t], &a[t], e, field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_powmod(&expected, p_a, e, field) == FP_POLY_E_SUCCESS);
+            assert_elem_equality(expected, &c[t], field);
+            assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        }
+        assert (fp_fq_from_poly(&c[t], p_a, field) == FP_POLY_E_SUCCESS);
+        assert (fp_fq_equal(&c[t], &a[t], field));
+        assert (fp_poly_free(p_a) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(p_b) == FP_POLY_E_SUCCESS);
+    }
+
+    // the array versions match the element versions
+    fp_fq_elem_t d;
+    fp_fq_mul_array(c, a, b, 8, field);
+    for (size_t t = 0; t < 8; t++)
+    {
+        fp_fq_mul(&d, &a[t], &b[t], field);
+        assert (fp_fq_equal(&c[t], &d, field));
+    }
+    fp_fq_sqr_array(c, a, 8, field);
+    for (size_t t = 0; t < 8; t++)
+    {
+        fp_fq_mul(&d, &a[t], &a[t], field);
+        assert (fp_fq_equal(&c[t], &d, field));
+    }
+    fp_fq_add_array(c, a, b, 8, field);
+    fp_fq_sub_array(c, c, b, 8, field);
+    for (size_t t = 0; t < 8; t++)
+        assert (fp_fq_equal(&c[t], &a[t], field));
+    mpz_clear(e);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3): x * x^2 = 1 + x and (x^2)^-1 = 1 + x + x^2
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    assert (fp_fq_is_supported(field));
+    fp_fq_elem_t a = {{0, 1, 0}}, b = {{0, 0, 1}}, c;
+    fp_fq_mul(&c, &a, &b, field);
+    assert (c.coeff[0] == 1 && c.coeff[1] == 1 && c.coeff[2] == 0);
+    assert (fp_fq_inv(&c, &b, field) == FP_POLY_E_SUCCESS);
+    assert (c.coeff[0] == 1 && c.coeff[1] == 1 && c.coeff[2] == 1);
+    fp_fq_zero(&c, field);
+    assert (fp_fq_is_zero(&c, field));
+    assert (fp_fq_inv(&c, &c, field) != FP_POLY_E_SUCCESS);
+    mpz_t e;
+    mpz_init_set_si(e, -1);
+    assert (fp_fq_pow(&c, &c, e, field) != FP_POLY_E_SUCCESS);
+    mpz_set_ui(e, 0);
+    assert (fp_fq_pow(&c, &c, e, field) == FP_POLY_E_SUCCESS);
+    fp_fq_one(&a, field);
+    assert (fp_fq_equal(&a, &c, field));
+    mpz_clear(e);
+    assert (fp_fq_from_poly(&c, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // a prime field has no modulus
+    field = fp_poly_init_prime_field(7);
+    assert (!fp_fq_is_supported(field));
+    fp_poly_t *p;
+    assert (fp_fq_to_poly(&p, &a, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random elements of fields with dense and sparse moduli
+    uint8_t orders[] = {2, 3, 251};
+    size_t degrees[] = {1, 2, 7, 40, FP_FQ_MAX_DEGREE};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+        for (size_t j = 0; j < sizeof(degrees) / sizeof(degrees[0]); j++)
+        {
+            field = fp_poly_init_prime_field(orders[i]);
+            fp_poly_t *irreducible = fp_poly_init_random_irreducible(degrees[j], field);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+            field = fp_poly_init_galois_field(orders[i], irreducible);
+            assert_fq_field(field);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+        }
+    field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}, 18));
+    assert (field->modulus->sparse_terms != 0);
+    assert_fq_field(field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <stdlib.h>
+#include "../../lib/include/fp_fq.h"
+
+static void assert_inv_batch(size_t len, fp_field_t *field)
+{
+    fp_fq_elem_t *in = malloc(len * sizeof(fp_fq_elem_t)), *out = malloc(len * sizeof(fp_fq_elem_t)), expected;
+    for (size_t i = 0; i < len; i++)
+    {
+        fp_fq_zero(&in[i], field);
+        // about one element out of eight is zero
+        if (rand() % 8 != 0)
+            for (size_t k = 0; k < field->modulus->degree; k++)
+                in[i].coeff[k] = rand() % field->order;
+    }
+    assert (fp_fq_inv_batch(out, in, len, field) == FP_POLY_E_SUCCESS);
+    for (size_t i = 0; i < len; i++)
+    {
+        if (fp_fq_is_zero(&in[i], field))
+        {
+            assert (fp_fq_is_zero(&out[i], field));
+            continue;
+        }
+        assert (fp_fq_inv(&expected, &in[i], field) == FP_POLY_E_SUCCESS);
+        assert (fp_fq_equal(&expected, &out[i], field));
+    }
+    free(in);
+    free(out);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3): x^-1 = 1 + x^2 and (x^2)^-1 = 1 + x + x^2
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    fp_fq_elem_t in[3] = {{{0, 1, 0}}, {{0, 0, 0}}, {{0, 0, 1}}}, out[3];
+    assert (fp_fq_inv_batch(out, in, 3, field) == FP_POLY_E_SUCCESS);
+    assert (out[0].coeff[0] == 1 && out[0].coeff[1] == 0 && out[0].coeff[2] == 1);
+    assert (fp_fq_is_zero(&out[1], field));
+    assert (out[2].coeff[0] == 1 && out[2].coeff[1] == 1 && out[2].coeff[2] == 1);
+    assert (fp_fq_inv_batch(out, in, 0, field) == FP_POLY_E_SUCCESS);
+    assert (fp_fq_inv_batch(out, &in[1], 1, field) == FP_POLY_E_SUCCESS);
+    assert (fp_fq_is_zero(&out[0], field));
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random batches
+    uint8_t orders[] = {2, 3, 251};
+    size_t degrees[] = {1, 5, 40};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+        for (size_t j = 0; j < sizeof(degrees) / sizeof(degrees[0]); j++)
+        {
+            field = fp_poly_init_prime_field(orders[i]);
+            fp_poly_t *irreducible = fp_poly_init_random_irreducible(degrees[j], field);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+            field = fp_poly_init_galois_field(orders[i], irreducible);
+            assert_inv_batch(1, field);
+            assert_inv_batch(100, field);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+        }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+
+static fp_poly_t *naive_compose_mod(uint8_t *f, size_t len_f, fp_poly_t *g, fp_field_t *field)
+{
+    // Horner method with schoolbook products: f(g) = (...(f_{m-1} g + f_{m-2}) g + ...) g + f_0 mod h
+    uint8_t order = field->order;
+    size_t n = field->modulus->degree, len_g = fp_poly_degree(g) + 1;
+    uint8_t *dense_g = calloc(len_g, 1), *res = calloc(n, 1), *prod = calloc(n + len_g, 1), *scratch = malloc(FP_POLY_MODULUS_SCRATCH(n));
+    for (size_t i = 0; i < len_g; i++)
+        if (mpz_tstbit(g->index_coeff, i))
+            dense_g[i] = fp_poly_degree_to_node_list(g, i)->coeff;
+    for (size_t i = len_f; i > 0; i--)
+    {
+        memset(prod, 0, n + len_g);
+        for (size_t k = 0; k < n; k++)
+            for (size_t l = 0; l < len_g; l++)
+                prod[k + l] = (prod[k + l] + res[k] * dense_g[l]) % order;
+        prod[0] = (prod[0] + f[i - 1]) % order;
+        assert (fp_poly_modulus_reduce(prod, n + len_g, scratch, field->modulus, order) == FP_POLY_E_SUCCESS);
+        memcpy(res, prod, n);
+    }
+    fp_poly_t *p_res = fp_poly_init_array(res, n);
+    free(dense_g);
+    free(res);
+    free(prod);
+    free(scratch);
+    return p_res;
+}
+
+static void assert_compose_mod(uint8_t *f, size_t len_f, fp_poly_t *g, fp_field_t *field)
+{
+    fp_poly_t *res, *p_f = fp_poly_init_array(f, len_f), *expected = naive_compose_mod(f, len_f, g, field);
+    assert (fp_poly_compose_mod(&res, p_f, g, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p_f) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3): f(x) = x^2 and g = x + x^2 give x^2 + x^4 = x
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    fp_poly_t *f = fp_poly_init_array((uint8_t[]) {0, 0, 1}, 3), *g = fp_poly_init_array((uint8_t[]) {0, 1, 1}, 3), *res;
+    assert (fp_poly_compose_mod(&res, f, g, field) == FP_POLY_E_SUCCESS);
+    fp_poly_t *expected = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_compose_mod(&res, NULL, g, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_compose_mod(&res, f, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_compose_mod(&res, f, g, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(f) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(g) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // a prime field has no modulus
+    field = fp_poly_init_prime_field(7);
+    f = fp_poly_init_array((uint8_t[]) {1, 2}, 2);
+    assert (fp_poly_compose_mod(&res, f, f, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_free(f) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // compositions with x (i.e., reductions of f) and with random polynoms match the Horner method
+    uint8_t orders[] = {2, 3, 251};
+    size_t degrees[] = {1, 7, 40};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+        for (size_t j = 0; j < sizeof(degrees) / sizeof(degrees[0]); j++)
+        {
+            field = fp_poly_init_prime_field(orders[i]);
+            fp_poly_t *irreducible = fp_poly_init_random_irreducible(degrees[j], field);
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+            field = fp_poly_init_galois_field(orders[i], irreducible);
+            uint8_t coeffs[100];
+            for (size_t len_f = 1; len_f <= 100; len_f += 11)
+            {
+                for (size_t k = 0; k < len_f; k++)
+                    coeffs[k] = rand() % orders[i];
+                coeffs[len_f - 1] = 1;
+                g = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+                assert_compose_mod(coeffs, len_f, g, field);
+                assert (fp_poly_free(g) == FP_POLY_E_SUCCESS);
+                g = fp_poly_init_random(degrees[j] + 5, field);
+                assert_compose_mod(coeffs, len_f, g, field);
+                assert (fp_poly_free(g) == FP_POLY_E_SUCCESS);
+            }
+            assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+        }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
+
+static void hello_world_tests()
+{
+    // over F_5, 1 + 2x + 3x^2 + 4x^3 at [0, 1, 2, 3, 4] gives [1, 0, 4, 2, 3]
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    uint8_t value, expected[] = {1, 0, 4, 2, 3};
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1, 2, 3, 4}, 4);
+    for (uint8_t x = 0; x < 5; x++)
+    {
+        assert (fp_poly_eval(&value, p, x, field) == FP_POLY_E_SUCCESS);
+        assert (value == expected[x]);
+    }
+    assert (fp_poly_eval(NULL, p, 0, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_eval(&value, NULL, 0, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_eval(&value, p, 0, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // x^(2^20) + x^17 + 1, whose index has 2^20 + 1 bits but only three set bits
+    uint8_t orders[] = {2, 3, 13, 251};
+    mpz_t index;
+    mpz_init(index);
+    mpz_setbit(index, 0);
+    mpz_setbit(index, 17);
+    mpz_setbit(index, (size_t) 1 << 20);
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        uint8_t order = orders[i];
+        field = fp_poly_init_prime_field(order);
+        p = fp_poly_init_mpz(index, list_create_from_array((uint8_t[]) {1, 1, 1}, 3));
+        assert (p != NULL);
+        uint8_t *values = malloc(order);
+        uint8_t *points = malloc(order);
+        for (size_t x = 0; x < order; x++)
+        {
+            points[x] = x;
+            assert (fp_poly_eval(&value, p, x, field) == FP_POLY_E_SUCCESS);
+            assert (value == (1 + naive_pow(x, 17, order) + naive_pow(x, (size_t) 1 << 20, order)) % order);
+        }
+        // the batched Horner method skips the gaps the same way
+        assert (fp_poly_eval_horner(values, p, points, order, field) == FP_POLY_E_SUCCESS);
+        for (size_t x = 0; x < order; x++)
+        {
+            assert (fp_poly_eval(&value, p, x, field) == FP_POLY_E_SUCCESS);
+            assert (values[x] == value);
+        }
+        free(values);
+        free(points);
+        assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+    mpz_clear(index);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
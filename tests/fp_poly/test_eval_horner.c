@@ -0,0 +1,75 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
+
+static void assert_eval_horner(size_t *degree, size_t nb_terms, size_t len, fp_field_t *field)
+{
+    // polynom with the given degrees and random non zero coefficients
+    uint8_t order = field->order;
+    size_t len_p = degree[nb_terms - 1] + 1;
+    uint8_t *coeff = malloc(nb_terms), *dense = calloc(len_p, 1), *points = malloc(len), *values = malloc(len);
+    for (size_t i = 0; i < nb_terms; i++)
+    {
+        coeff[i] = 1 + rand() % (order - 1);
+        dense[degree[i]] = coeff[i];
+    }
+    for (size_t i = 0; i < len; i++)
+        points[i] = rand() % order;
+    fp_poly_t *p = fp_poly_init_array(dense, len_p);
+    assert (fp_poly_eval_horner(values, p, points, len, field) == FP_POLY_E_SUCCESS);
+    for (size_t i = 0; i < len; i++)
+    {
+        uint16_t expected = 0;
+        for (size_t t = 0; t < nb_terms; t++)
+            expected = (expected + coeff[t] * naive_pow(points[i], degree[t], order)) % order;
+        assert (values[i] == expected);
+    }
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    free(coeff);
+    free(dense);
+    free(points);
+    free(values);
+}
+
+static void hello_world_tests()
+{
+    // over F_5, 1 + 2x + 3x^2 + 4x^3 at [0, 1, 2, 3, 4] gives [1, 0, 4, 2, 3]
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    uint8_t values[5];
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1, 2, 3, 4}, 4);
+    assert (fp_poly_eval_horner(values, p, (uint8_t[]) {0, 1, 2, 3, 4}, 5, field) == FP_POLY_E_SUCCESS);
+    assert (memcmp(values, (uint8_t[]) {1, 0, 4, 2, 3}, 5) == 0);
+    assert (fp_poly_eval_horner(NULL, p, (uint8_t[]) {0}, 1, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_eval_horner(values, NULL, (uint8_t[]) {0}, 1, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_eval_horner(values, p, (uint8_t[]) {0}, 1, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+
+    // x^2 + x^5 at [0, 1, 2, 3] gives [0, 2, 1, 2]
+    p = fp_poly_init_array((uint8_t[]) {0, 0, 1, 0, 0, 1}, 6);
+    assert (fp_poly_eval_horner(values, p, (uint8_t[]) {0, 1, 2, 3}, 4, field) == FP_POLY_E_SUCCESS);
+    assert (memcmp(values, (uint8_t[]) {0, 2, 1, 2}, 4) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // dense and sparse polynoms, with a number of points which is not a multiple of the lanes
+    size_t dense[100], sparse[] = {0, 3, 64, 65, 1000, 4097};
+    for (size_t i = 0; i < 100; i++)
+        dense[i] = i;
+    uint8_t orders[] = {2, 3, 13, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        assert_eval_horner(dense, 1, 1, field);
+        assert_eval_horner(dense, 100, 37, field);
+        assert_eval_horner(sparse, 6, 50, field);
+        assert_eval_horner(sparse + 2, 4, 16, field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+
+static uint8_t naive_eval(uint8_t *p, size_t len, uint8_t x, uint8_t order)
+{
+    uint16_t value = 0;
+    for (size_t i = len; i > 0; i--)
+        value = (value * x + p[i - 1]) % order;
+    return value;
+}
+
+static void assert_eval_multi(size_t len_p, size_t len, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    uint8_t *p = malloc(len_p), *points = malloc(len), *values = malloc(len);
+    for (size_t i = 0; i < len_p; i++)
+        p[i] = rand() % order;
+    p[len_p - 1] = 1 + rand() % (order - 1);
+    for (size_t i = 0; i < len; i++)
+        points[i] = rand() % order;
+    fp_poly_t *poly = fp_poly_init_array(p, len_p);
+    assert (fp_poly_eval_multi(values, poly, points, len, field) == FP_POLY_E_SUCCESS);
+    for (size_t i = 0; i < len; i++)
+        assert (values[i] == naive_eval(p, len_p, points[i], order));
+    assert (fp_poly_free(poly) == FP_POLY_E_SUCCESS);
+    free(p);
+    free(points);
+    free(values);
+}
+
+static void hello_world_tests()
+{
+    // the subproduct tree of [1, 2, 3] over F_5
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    fp_subproduct_tree_t *tree = fp_poly_subproduct_tree_init((uint8_t[]) {1, 2, 3}, 3, field);
+    assert (tree != NULL && tree->height == 3);
+    assert (memcmp(tree->level[0], (uint8_t[]) {4, 1, 3, 1, 2, 1}, 6) == 0);
+    assert (memcmp(tree->level[1], (uint8_t[]) {2, 2, 1, 2, 1}, 5) == 0);
+    assert (memcmp(tree->level[2], (uint8_t[]) {4, 1, 4, 1}, 4) == 0);
+
+    // the tree is reused: 1 + 2x + 3x^2 + 4x^3 gives [0, 4, 2] and x^7 gives [1, 3, 2]
+    uint8_t values[3];
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1, 2, 3, 4}, 4);
+    assert (fp_poly_eval_tree(values, p, tree, field) == FP_POLY_E_SUCCESS);
+    assert (values[0] == 0 && values[1] == 4 && values[2] == 2);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {0, 0, 0, 0, 0, 0, 0, 1}, 8);
+    assert (fp_poly_eval_tree(values, p, tree, field) == FP_POLY_E_SUCCESS);
+    assert (values[0] == 1 && values[1] == 3 && values[2] == 2);
+    assert (fp_poly_eval_tree(NULL, p, tree, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_eval_tree(values, NULL, tree, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_eval_tree(values, p, tree, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_eval_multi(values, p, (uint8_t[]) {4}, 1, field) == FP_POLY_E_SUCCESS);
+    assert (values[0] == 4);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_subproduct_tree_free(tree) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_subproduct_tree_init((uint8_t[]) {1}, 0, field) == NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random polynoms, shorter and longer than the number of points
+    uint8_t orders[] = {2, 3, 251};
+    size_t lens[][2] = {{1, 1}, {5, 2}, {2, 17}, {40, 33}, {300, 1000}, {1000, 300}, {3000, 700}};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(lens) / sizeof(lens[0]); j++)
+            assert_eval_multi(lens[j][0], lens[j][1], field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "../../lib/include/fp_poly.h"
+
+static void assert_frobenius(fp_poly_t *a, uint8_t *expected, size_t len_expected, fp_field_t *field)
+{
+    fp_poly_t *res, *p_expected = fp_poly_init_array(expected, len_expected);
+    assert (fp_poly_frobenius(&res, a, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(p_expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p_expected) == FP_POLY_E_SUCCESS);
+}
+
+static void assert_trace(uint8_t *a, size_t len_a, uint8_t expected, fp_field_t *field)
+{
+    fp_poly_t *p = fp_poly_init_array(a, len_a);
+    uint8_t trace;
+    assert (fp_poly_trace(&trace, p, field) == FP_POLY_E_SUCCESS);
+    assert (trace == expected);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3): x -> x^2 -> x + x^2 -> x, without then with the Frobenius matrix
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    fp_poly_t *a;
+    for (size_t pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+            assert (fp_poly_init_frobenius(field) == FP_POLY_E_SUCCESS);
+        a = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+        assert_frobenius(a, (uint8_t[]) {0, 0, 1}, 3, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+        a = fp_poly_init_array((uint8_t[]) {0, 0, 1}, 3);
+        assert_frobenius(a, (uint8_t[]) {0, 1, 1}, 3, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+        a = fp_poly_init_array((uint8_t[]) {0, 1, 1}, 3);
+        assert_frobenius(a, (uint8_t[]) {0, 1}, 2, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+        assert_trace((uint8_t[]) {1}, 1, 1, field);
+        assert_trace((uint8_t[]) {0, 1}, 2, 0, field);
+        assert_trace((uint8_t[]) {0, 0, 0, 1}, 4, 1, field);
+        assert_trace((uint8_t[]) {0}, 1, 0, field);
+        // the operations never build the matrix themselves
+        assert ((field->frobenius != NULL) == pass);
+    }
+    uint8_t trace;
+    assert (fp_poly_trace(&trace, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_frobenius(&a, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_init_frobenius(NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // a prime field has no Frobenius matrix
+    field = fp_poly_init_prime_field(7);
+    assert (fp_poly_init_frobenius(field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{251^2} = F_251[x] / (1 + x^2): (a + bx)^251 = a - bx and Tr(a + bx) = 2a
+    field = fp_poly_init_galois_field(251, fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3));
+    assert (fp_poly_init_frobenius(field) == FP_POLY_E_SUCCESS);
+    a = fp_poly_init_array((uint8_t[]) {7, 3}, 2);
+    assert_frobenius(a, (uint8_t[]) {7, 248}, 2, field);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert_trace((uint8_t[]) {7, 3}, 2, 14, field);
+    assert_trace((uint8_t[]) {200, 3}, 2, 149, field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{5^7} = F_5[x] / (2 + 4x + x^7): the Frobenius map is a^5, and has order 7
+    field = fp_poly_init_galois_field(5, fp_poly_init_array((uint8_t[]) {2, 4, 0, 0, 0, 0, 0, 1}, 8));
+    mpz_t e;
+    mpz_init_set_ui(e, 5);
+    for (size_t i = 0; i < 8; i++)
+    {
+        // the first half runs without the Frobenius matrix, the second half with it
+        if (i == 4)
+            assert (fp_poly_init_frobenius(field) == FP_POLY_E_SUCCESS);
+        a = fp_poly_init_random(i + 3, field);
+        fp_poly_t *expected, *res, *tmp;
+        assert (fp_poly_powmod(&expected, a, e, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_frobenius(&res, a, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        uint16_t sum = mpz_tstbit(res->index_coeff, 0) ? res->coeff->head->coeff : 0;
+        for (size_t k = 1; k < 7; k++)
+        {
+            assert (fp_poly_frobenius(&tmp, res, field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+            res = tmp;
+            sum += mpz_tstbit(res->index_coeff, 0) ? res->coeff->head->coeff : 0;
+        }
+        // a^(5^7) = a, and the trace is the constant coefficient of the sum of the conjugates
+        mpz_set_ui(e, 1);
+        assert (fp_poly_powmod(&expected, a, e, field) == FP_POLY_E_SUCCESS);
+        mpz_set_ui(e, 5);
+        assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+        uint8_t trace;
+        assert (fp_poly_trace(&trace, a, field) == FP_POLY_E_SUCCESS);
+        assert (trace == sum % 5);
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    }
+    mpz_clear(e);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
 #include <unistd.h>
 
 #define BUFFER_SIZE 32768
@@ -52,9 +53,132 @@ static void pari_gp_test(char *filename)
     fclose(file);
 }
 
+static fp_poly_t *random_multiple(uint8_t *dense, const uint8_t *g, size_t len_g, size_t len_x, uint8_t order)
+{
+    // g times a random polynom of length len_x
+    uint8_t *x = malloc(len_x);
+    for (size_t i = 0; i < len_x; i++)
+        x[i] = rand() % order;
+    x[len_x - 1] = 1 + rand() % (order - 1);
+    naive_mul(dense, g, len_g, x, len_x, order);
+    free(x);
+    return fp_poly_init_array(dense, len_g + len_x - 1);
+}
+
+static void assert_gcd(size_t len_g, size_t len_x, size_t len_y, fp_field_t *field)
+{
+    // a = g x and b = g y, where x and y are random (hence not always coprime)
+    uint8_t order = field->order;
+    size_t len_a = len_g + len_x - 1, len_b = len_g + len_y - 1;
+    uint8_t *g = malloc(len_g), *a = malloc(len_a), *b = malloc(len_b), *expected = malloc(len_a > len_b ? len_a : len_b);
+    for (size_t i = 0; i < len_g; i++)
+        g[i] = rand() % order;
+    g[len_g - 1] = 1 + rand() % (order - 1);
+    fp_poly_t *p = random_multiple(a, g, len_g, len_x, order), *q = random_multiple(b, g, len_g, len_y, order), *res;
+    size_t len = naive_gcd(expected, a, len_a, b, len_b, order);
+
+    assert (fp_poly_gcd(&res, p, q, field) == FP_POLY_E_SUCCESS);
+    assert (res->coeff->tail->coeff == 1);
+    assert_dense(res, expected, len);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_gcd(&res, q, p, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, expected, len);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    free(g);
+    free(a);
+    free(b);
+    free(expected);
+}
+
+static void assert_gcd_f2(size_t len_g, size_t len_x, size_t len_y)
+{
+    // same as assert_gcd() over F_2, but the expected result is computed on bits packed in mpz_t numbers
+    fp_field_t *field = fp_poly_init_prime_field(2);
+    size_t len_a = len_g + len_x - 1, len_b = len_g + len_y - 1;
+    uint8_t *g = malloc(len_g), *a = malloc(len_a), *b = malloc(len_b);
+    for (size_t i = 0; i < len_g; i++)
+        g[i] = rand() % 2;
+    g[len_g - 1] = 1;
+    fp_poly_t *p = random_multiple(a, g, len_g, len_x, 2), *q = random_multiple(b, g, len_g, len_y, 2), *res;
+    mpz_t r0, r1, shifted;
+    mpz_inits(r0, r1, shifted, NULL);
+    for (size_t i = 0; i < len_a; i++)
+        if (a[i])
+            mpz_setbit(r0, i);
+    for (size_t i = 0; i < len_b; i++)
+        if (b[i])
+            mpz_setbit(r1, i);
+    while (mpz_sgn(r1) != 0)
+    {
+        size_t degree = mpz_sizeinbase(r1, 2) - 1;
+        while (mpz_sgn(r0) != 0 && mpz_sizeinbase(r0, 2) - 1 >= degree)
+        {
+            mpz_mul_2exp(shifted, r1, mpz_sizeinbase(r0, 2) - 1 - degree);
+            mpz_xor(r0, r0, shifted);
+        }
+        mpz_swap(r0, r1);
+    }
+
+    assert (fp_poly_gcd(&res, p, q, field) == FP_POLY_E_SUCCESS);
+    list_t *lst = list_init();
+    for (size_t i = 0; i < mpz_popcount(r0); i++)
+        list_add_beginning(lst, 1);
+    assert (fp_poly_assert_mpz(res, r0, lst) == FP_POLY_E_SUCCESS);
+    list_destroy(lst);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    mpz_clears(r0, r1, shifted, NULL);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    free(g);
+    free(a);
+    free(b);
+}
+
+static void hello_world_tests()
+{
+    // over F_5, gcd(2 (x + 1)(x + 2), 3 (x + 1)(x + 3)) = x + 1
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {4, 1, 2}, 3), *q = fp_poly_init_array((uint8_t[]) {4, 2, 3}, 3), *zero = fp_poly_init_array((uint8_t[]) {0}, 1), *res;
+    assert (fp_poly_gcd(&res, p, q, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {1, 1}, 2);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    // the greatest common divisor with zero is the monic polynom
+    assert (fp_poly_gcd(&res, zero, p, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {2, 3, 1}, 3);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_gcd(&res, zero, zero, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {0}, 1);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_gcd(&res, NULL, q, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_gcd(&res, p, q, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(zero) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // the in place Euclidean algorithm, and the half-GCD above the thresholds of the dispatch
+    size_t sizes[][3] = {{1, 1, 1}, {1, 20, 3}, {7, 7, 7}, {30, 40, 50}, {100, 200, 150}, {50, FP_POLY_GCD_THRESHOLD + 100, FP_POLY_GCD_THRESHOLD}};
+    uint8_t orders[] = {2, 3, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++)
+            assert_gcd(sizes[j][0], sizes[j][1], sizes[j][2], field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+    assert_gcd_f2(50, FP_POLY_GCD_F2_THRESHOLD + 100, FP_POLY_GCD_F2_THRESHOLD);
+}
+
 int main()
 {
-    //hello_world_tests();
-    pari_gp_test("../../../tests/fp_poly/input_test/test_gcd.txt");
+    hello_world_tests();
+    // the inputs are generated by generate_input.gp
+    if (access("../../../tests/fp_poly/input_test/test_gcd.txt", R_OK) == 0)
+        pari_gp_test("../../../tests/fp_poly/input_test/test_gcd.txt");
     return 0;
-}
\ No newline at end of file
+}
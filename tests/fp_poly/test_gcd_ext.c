@@ -1,4 +1,5 @@
 #include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
 #include <unistd.h>
 
 #define BUFFER_SIZE 32768
@@ -38,9 +39,96 @@ static void pari_gp_test(char *filename)
     fclose(file);
 }
 
+static void assert_gcd_extended(size_t len_g, size_t len_x, size_t len_y, fp_field_t *field)
+{
+    // a = g x and b = g y, where x and y are random (hence not always coprime)
+    uint8_t order = field->order;
+    size_t len_a = len_g + len_x - 1, len_b = len_g + len_y - 1, len = len_a + len_b;
+    uint8_t *g = malloc(len_g), *x = malloc(len_x), *y = malloc(len_y), *a = malloc(len_a), *b = malloc(len_b);
+    uint8_t *expected = malloc(len), *u = malloc(len), *v = malloc(len), *ua = malloc(len), *vb = malloc(len);
+    for (size_t i = 0; i < len_g; i++)
+        g[i] = rand() % order;
+    g[len_g - 1] = 1 + rand() % (order - 1);
+    for (size_t i = 0; i < len_x; i++)
+        x[i] = rand() % order;
+    x[len_x - 1] = 1 + rand() % (order - 1);
+    for (size_t i = 0; i < len_y; i++)
+        y[i] = rand() % order;
+    y[len_y - 1] = 1 + rand() % (order - 1);
+    naive_mul(a, g, len_g, x, len_x, order);
+    naive_mul(b, g, len_g, y, len_y, order);
+    size_t len_gcd = naive_gcd(expected, a, len_a, b, len_b, order);
+    fp_poly_t *p = fp_poly_init_array(a, len_a), *q = fp_poly_init_array(b, len_b), *res, *res_u, *res_v;
+
+    assert (fp_poly_gcd_extended(&res, &res_u, &res_v, p, q, field) == FP_POLY_E_SUCCESS);
+    assert (res->coeff->tail->coeff == 1);
+    assert_dense(res, expected, len_gcd);
+    // u a + v b = g, with deg(u) < deg(b) - deg(g) and deg(v) < deg(a) - deg(g) (or u and v constant)
+    size_t len_u = fp_poly_degree(res_u) + 1, len_v = fp_poly_degree(res_v) + 1;
+    assert (len_u == 1 || len_u < len_b - len_gcd + 1);
+    assert (len_v == 1 || len_v < len_a - len_gcd + 1);
+    to_dense(u, len_u, res_u);
+    to_dense(v, len_v, res_v);
+    naive_mul(ua, u, len_u, a, len_a, order);
+    naive_mul(vb, v, len_v, b, len_b, order);
+    for (size_t i = 0; i < len - 1; i++)
+    {
+        uint8_t lhs = ((i < len_u + len_a - 1 ? ua[i] : 0) + (i < len_v + len_b - 1 ? vb[i] : 0)) % order;
+        assert (lhs == (i < len_gcd ? expected[i] : 0));
+    }
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res_u) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res_v) == FP_POLY_E_SUCCESS);
+
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    free(g);
+    free(x);
+    free(y);
+    free(a);
+    free(b);
+    free(expected);
+    free(u);
+    free(v);
+    free(ua);
+    free(vb);
+}
+
+static void hello_world_tests()
+{
+    // over F_5, gcd(2 (x + 1)(x + 2), 3 (x + 1)(x + 3)) = x + 1 = u a + v b with u = 2 and v = 2
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {4, 1, 2}, 3), *q = fp_poly_init_array((uint8_t[]) {4, 2, 3}, 3), *res, *u, *v;
+    assert (fp_poly_gcd_extended(&res, &u, &v, p, q, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {1, 1}, 2);
+    assert_dense(u, (uint8_t[]) {2}, 1);
+    assert_dense(v, (uint8_t[]) {2}, 1);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(u) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(v) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_gcd_extended(&res, &u, &v, NULL, q, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_gcd_extended(&res, &u, &v, p, q, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // the Euclidean steps below the threshold, and the recursive half-GCD above it
+    size_t sizes[][3] = {{1, 1, 1}, {1, 20, 3}, {7, 7, 7}, {30, 40, 50}, {5, FP_POLY_HGCD_THRESHOLD, FP_POLY_HGCD_THRESHOLD + 1}, {20, 8 * FP_POLY_HGCD_THRESHOLD, 6 * FP_POLY_HGCD_THRESHOLD}};
+    uint8_t orders[] = {2, 3, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++)
+            assert_gcd_extended(sizes[j][0], sizes[j][1], sizes[j][2], field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+}
+
 int main()
 {
-    //hello_world_tests();
-    pari_gp_test("../../../tests/fp_poly/input_test/test_gcd_ext.txt");
+    hello_world_tests();
+    // the inputs are generated by generate_input.gp
+    if (access("../../../tests/fp_poly/input_test/test_gcd_ext.txt", R_OK) == 0)
+        pari_gp_test("../../../tests/fp_poly/input_test/test_gcd_ext.txt");
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+
+static void assert_interpolate(size_t len, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    uint8_t *points = malloc(order), *values = malloc(len), *check = malloc(len);
+    // distinct abscissas: the first len elements of a shuffle of the field
+    for (size_t i = 0; i < order; i++)
+        points[i] = i;
+    for (size_t i = order - 1; i > 0; i--)
+    {
+        size_t j = rand() % (i + 1);
+        uint8_t tmp = points[i];
+        points[i] = points[j];
+        points[j] = tmp;
+    }
+    for (size_t i = 0; i < len; i++)
+        values[i] = rand() % order;
+    fp_poly_t *res;
+    fp_subproduct_tree_t *tree = fp_poly_subproduct_tree_init(points, len, field);
+    assert (fp_poly_interpolate_tree(&res, values, tree, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_degree(res) < len);
+    assert (fp_poly_eval_tree(check, res, tree, field) == FP_POLY_E_SUCCESS);
+    assert (memcmp(values, check, len) == 0);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_subproduct_tree_free(tree) == FP_POLY_E_SUCCESS);
+    free(points);
+    free(values);
+    free(check);
+}
+
+static void hello_world_tests()
+{
+    // over F_5, the polynom through (1, 0), (2, 4) and (3, 2) is 3x + 2x^2
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    fp_poly_t *res, *expected = fp_poly_init_array((uint8_t[]) {0, 3, 2}, 3);
+    assert (fp_poly_interpolate(&res, (uint8_t[]) {1, 2, 3}, (uint8_t[]) {0, 4, 2}, 3, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // constant values give a constant polynom, and zero values give the zero polynom
+    expected = fp_poly_init_array((uint8_t[]) {3}, 1);
+    assert (fp_poly_interpolate(&res, (uint8_t[]) {0, 4, 2, 1}, (uint8_t[]) {3, 3, 3, 3}, 4, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    expected = fp_poly_init_array((uint8_t[]) {0}, 1);
+    assert (fp_poly_interpolate(&res, (uint8_t[]) {0, 4}, (uint8_t[]) {0, 0}, 2, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // the abscissas must be distinct
+    assert (fp_poly_interpolate(&res, (uint8_t[]) {1, 2, 6}, (uint8_t[]) {0, 4, 2}, 3, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_interpolate(&res, (uint8_t[]) {1, 2, 3}, NULL, 3, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_interpolate(&res, (uint8_t[]) {1, 2, 3}, (uint8_t[]) {0, 4, 2}, 3, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random values, up to all the elements of the field
+    uint8_t orders[] = {2, 3, 13, 251};
+    size_t lens[] = {1, 2, 3, 13, 17, 100, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(lens) / sizeof(lens[0]) && lens[j] <= orders[i]; j++)
+            assert_interpolate(lens[j], field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
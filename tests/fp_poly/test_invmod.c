@@ -0,0 +1,84 @@
+#include "../../lib/include/fp_poly.h"
+
+static void assert_inverse(fp_poly_t *a, fp_field_t *field)
+{
+    fp_poly_t *inv, *prod;
+    assert (fp_poly_invmod(&inv, a, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mul_fq(&prod, a, inv, field) == FP_POLY_E_SUCCESS);
+    list_t *one = list_create_from_array((uint8_t[]) {1}, 1);
+    assert (fp_poly_assert_sizet(prod, 0x1, one) == FP_POLY_E_SUCCESS);
+    assert (list_destroy(one) == LIST_E_SUCCESS);
+    assert (fp_poly_free(inv) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(prod) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3), the inverse of x is 1 + x^2
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    fp_poly_t *a = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+    fp_poly_t *inv;
+    assert (fp_poly_invmod(&inv, a, field) == FP_POLY_E_SUCCESS);
+    list_t *coeff_inv = list_create_from_array((uint8_t[]) {1, 1}, 2);
+    assert (fp_poly_assert_sizet(inv, 0x5, coeff_inv) == FP_POLY_E_SUCCESS);
+    assert (list_destroy(coeff_inv) == LIST_E_SUCCESS);
+    assert (fp_poly_free(inv) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+
+    // every non zero element of F_8, and the same elements plus x^5 = 1 + x + x^2 (mod 1 + x + x^3)
+    for (uint8_t i = 1; i < 8; i++)
+    {
+        a = fp_poly_init_array((uint8_t[]) {i & 1, (i >> 1) & 1, (i >> 2) & 1}, 3);
+        assert_inverse(a, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+        if (i == 7)
+            continue;
+        a = fp_poly_init_array((uint8_t[]) {i & 1, (i >> 1) & 1, (i >> 2) & 1, 0, 0, 1}, 6);
+        assert_inverse(a, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    }
+
+    // the zero polynom and the multiples of the modulus are not invertible
+    a = fp_poly_init_array((uint8_t[]) {0}, 1);
+    assert (fp_poly_invmod(&inv, a, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    a = fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4);
+    assert (fp_poly_invmod(&inv, a, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_invmod(&inv, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_invmod(&inv, a, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // a prime field has no prepared modulus
+    field = fp_poly_init_prime_field(7);
+    a = fp_poly_init_array((uint8_t[]) {3}, 1);
+    assert (fp_poly_invmod(&inv, a, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{251^2} = F_251[x] / (1 + x^2)
+    field = fp_poly_init_galois_field(251, fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3));
+    for (uint8_t i = 0; i < 250; i += 7)
+    {
+        a = fp_poly_init_array((uint8_t[]) {i, 250 - i}, 2);
+        assert_inverse(a, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    }
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{5^7} = F_5[x] / (2 + 4x + x^7), random elements
+    field = fp_poly_init_galois_field(5, fp_poly_init_array((uint8_t[]) {2, 4, 0, 0, 0, 0, 0, 1}, 8));
+    for (size_t i = 0; i < 32; i++)
+    {
+        a = fp_poly_init_random(i % 10, field);
+        assert_inverse(a, field);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    }
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
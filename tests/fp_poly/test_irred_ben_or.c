@@ -0,0 +1,90 @@
+#include "../../lib/include/fp_poly.h"
+
+// the Ben-Or test and the Rabin test agree on every monic polynom of degree n over F_p
+static void exhaustive_tests(uint8_t order, size_t n)
+{
+    fp_field_t *field = fp_poly_init_prime_field(order);
+    size_t nb_polynoms = 1;
+    for (size_t i = 0; i < n; i++)
+        nb_polynoms *= order;
+    uint8_t coeff[16];
+    for (size_t v = 0; v < nb_polynoms; v++)
+    {
+        size_t w = v;
+        for (size_t i = 0; i < n; i++)
+        {
+            coeff[i] = w % order;
+            w /= order;
+        }
+        coeff[n] = 1;
+        fp_poly_t *p = fp_poly_init_array(coeff, n + 1);
+        assert (fp_poly_is_irreducible_ben_or(p, field) == fp_poly_is_irreducible(p, field));
+        assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    }
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+static void random_tests(uint8_t order, size_t n)
+{
+    fp_field_t *field = fp_poly_init_prime_field(order);
+    for (size_t i = 0; i < 16; i++)
+    {
+        fp_poly_t *p = fp_poly_init_random(n, field);
+        assert (fp_poly_is_irreducible_ben_or(p, field) == fp_poly_is_irreducible(p, field));
+        assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    }
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    fp_field_t *field = fp_poly_init_prime_field(2);
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1}, 1);
+    assert (fp_poly_is_irreducible_ben_or(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4);
+    assert (fp_poly_is_irreducible_ben_or(p, field) == 1);
+    assert (fp_poly_is_irreducible_ben_or(NULL, field) == 0);
+    assert (fp_poly_is_irreducible_ben_or(p, NULL) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    // (1 + x + x^2)^2 and (1 + x + x^3)(1 + x^2 + x^3)
+    p = fp_poly_init_array((uint8_t[]) {1, 0, 1, 0, 1}, 5);
+    assert (fp_poly_is_irreducible_ben_or(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {1, 1, 1, 1, 1, 1, 1}, 7);
+    assert (fp_poly_is_irreducible_ben_or(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // the generator only returns monic irreducible polynoms of the requested degree
+    uint8_t orders[] = {2, 3, 5, 251};
+    size_t degrees[] = {1, 2, 5, 40};
+    for (size_t i = 0; i < 4; i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < 4; j++)
+        {
+            p = fp_poly_init_random_irreducible(degrees[j], field);
+            assert (fp_poly_degree(p) == degrees[j]);
+            assert (p->coeff->tail->coeff == 1);
+            assert (fp_poly_is_irreducible(p, field) == 1);
+            assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+        }
+        assert (fp_poly_init_random_irreducible(0, field) == NULL);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+    assert (fp_poly_init_random_irreducible(5, NULL) == NULL);
+}
+
+int main()
+{
+    hello_world_tests();
+    for (size_t n = 1; n <= 10; n++)
+        exhaustive_tests(2, n);
+    for (size_t n = 1; n <= 5; n++)
+        exhaustive_tests(3, n);
+    random_tests(2, 60);
+    random_tests(5, 30);
+    random_tests(251, 12);
+    return 0;
+}
@@ -3,24 +3,34 @@
 int main(int argc, char const *argv[])
 {
     assert (argc == 2);
+    // the generated polynoms are also written for verify_input_poly.gp when the input directory exists
     FILE *file = fopen("../../../tests/fp_poly/input_test/random_irred_poly.txt", "w");
-    for (uint8_t i = 0; i < 8; i++)
+    // atoi(argv[1]) == 1 if it is short test
+    size_t short_degrees[] = {1, 2, 5, 17, 64}, long_degrees[] = {127, 256};
+    size_t *degrees = atoi(argv[1]) == 1 ? short_degrees : long_degrees;
+    size_t nb_degrees = atoi(argv[1]) == 1 ? sizeof(short_degrees) / sizeof(short_degrees[0]) : sizeof(long_degrees) / sizeof(long_degrees[0]);
+    uint8_t orders[] = {2, 3, 5, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
     {
-        for (size_t j = 2; j < 5; j++)
+        fp_field_t *f = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < nb_degrees; j++)
         {
-            fp_poly_t *p;
-            fp_field_t *f = fp_poly_init_prime_field(j);
-            // atoi(argv[1]) == 1 if it is short test
-            if (atoi(argv[1]) == 1)
-                p = fp_poly_init_random_irreducible(5, f);
-            else
-                p = fp_poly_init_random_irreducible(10, f);
-            fp_poly_print(file, p);
+            fp_poly_t *p = fp_poly_init_random_irreducible(degrees[j], f);
+            assert (p != NULL);
+            assert (fp_poly_degree(p) == degrees[j]);
+            // checked with the Rabin test, while the generator runs the Ben-Or test
+            assert (fp_poly_is_irreducible(p, f) == 1);
+            if (file)
+            {
+                fp_poly_print(file, p);
+                fwrite("\n", sizeof(char), 1, file);
+            }
             assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
-            assert (fp_poly_free_field(f) == FP_POLY_E_SUCCESS);
-            fwrite("\n", sizeof(char), 1, file);
         }
+        assert (fp_poly_free_field(f) == FP_POLY_E_SUCCESS);
     }
-    fclose(file);
+    assert (fp_poly_init_random_irreducible(0, NULL) == NULL);
+    if (file)
+        fclose(file);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,116 @@
+#include "../../lib/include/fp_poly.h"
+
+static int64_t moebius(int64_t n)
+{
+    int64_t res = 1;
+    for (int64_t p = 2; p * p <= n; p++)
+    {
+        if (n % p != 0)
+            continue;
+        n /= p;
+        if (n % p == 0)
+            return 0;
+        res = -res;
+    }
+    return n > 1 ? -res : res;
+}
+
+// the number of monic irreducible polynoms of degree n over F_p is (1 / n) sum_{d | n} moebius(d) p^(n / d)
+static void count_tests(uint8_t order, size_t n)
+{
+    fp_field_t *field = fp_poly_init_prime_field(order);
+    int64_t expected = 0, count = 0, nb_polynoms = 1;
+    for (size_t i = 0; i < n; i++)
+        nb_polynoms *= order;
+    for (size_t d = 1; d <= n; d++)
+    {
+        if (n % d != 0)
+            continue;
+        int64_t power = 1;
+        for (size_t i = 0; i < n / d; i++)
+            power *= order;
+        expected += moebius(d) * power;
+    }
+    expected /= n;
+    uint8_t coeff[16];
+    for (int64_t v = 0; v < nb_polynoms; v++)
+    {
+        int64_t w = v;
+        for (size_t i = 0; i < n; i++)
+        {
+            coeff[i] = w % order;
+            w /= order;
+        }
+        coeff[n] = 1;
+        fp_poly_t *p = fp_poly_init_array(coeff, n + 1);
+        count += fp_poly_is_irreducible(p, field);
+        assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    }
+    assert (count == expected);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+static void trinomial_test(size_t n, size_t k, uint8_t is_irreducible, fp_field_t *field)
+{
+    uint8_t *coeff = (uint8_t *) calloc(n + 1, 1);
+    coeff[0] = 1;
+    coeff[k] = 1;
+    coeff[n] = 1;
+    fp_poly_t *p = fp_poly_init_array(coeff, n + 1);
+    assert (fp_poly_is_irreducible(p, field) == is_irreducible);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    free(coeff);
+}
+
+static void hello_world_tests()
+{
+    fp_field_t *field = fp_poly_init_prime_field(2);
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1}, 1);
+    assert (fp_poly_is_irreducible(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3);
+    assert (fp_poly_is_irreducible(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4);
+    assert (fp_poly_is_irreducible(p, field) == 1);
+    assert (fp_poly_is_irreducible(NULL, field) == 0);
+    assert (fp_poly_is_irreducible(p, NULL) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    // (1 + x + x^2)^2 has no root but is reducible
+    p = fp_poly_init_array((uint8_t[]) {1, 0, 1, 0, 1}, 5);
+    assert (fp_poly_is_irreducible(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    // primitive trinomials
+    trinomial_test(127, 1, 1, field);
+    trinomial_test(521, 32, 1, field);
+    trinomial_test(128, 1, 0, field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // non monic polynoms: 2 + 2x^2 = 2(1 + x^2) over F_3 and 1 + x^2 over F_251
+    field = fp_poly_init_prime_field(3);
+    p = fp_poly_init_array((uint8_t[]) {2, 0, 2}, 3);
+    assert (fp_poly_is_irreducible(p, field) == 1);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_prime_field(251);
+    p = fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3);
+    assert (fp_poly_is_irreducible(p, field) == 1);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {250, 0, 1}, 3);
+    assert (fp_poly_is_irreducible(p, field) == 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+    for (size_t n = 1; n <= 10; n++)
+        count_tests(2, n);
+    for (size_t n = 1; n <= 6; n++)
+        count_tests(3, n);
+    for (size_t n = 1; n <= 4; n++)
+        count_tests(5, n);
+    count_tests(7, 3);
+    return 0;
+}
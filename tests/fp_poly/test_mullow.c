@@ -0,0 +1,89 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
+
+static void assert_truncated_products(size_t len_a, size_t len_b, size_t n, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    size_t len = len_a + len_b - 1;
+    uint8_t *a = malloc(len_a), *b = malloc(len_b), *full = malloc(len);
+    for (size_t i = 0; i < len_a; i++)
+        a[i] = rand() % order;
+    for (size_t i = 0; i < len_b; i++)
+        b[i] = rand() % order;
+    a[len_a - 1] = 1 + rand() % (order - 1);
+    b[len_b - 1] = 1 + rand() % (order - 1);
+    naive_mul(full, a, len_a, b, len_b, order);
+    fp_poly_t *p = fp_poly_init_array(a, len_a), *q = fp_poly_init_array(b, len_b), *res;
+
+    assert (fp_poly_mullow(&res, p, q, n, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, full, n < len ? n : len);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    assert (fp_poly_mulhigh(&res, p, q, n, field) == FP_POLY_E_SUCCESS);
+    if (n < len)
+        assert_dense(res, full + n, len - n);
+    else
+        assert_dense(res, (uint8_t[]) {0}, 1);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // middle product of length n: a mod x^(2n - 1) and b mod x^n
+    size_t len_mid_a = len_a < 2 * n - 1 ? len_a : 2 * n - 1, len_mid_b = len_b < n ? len_b : n;
+    uint8_t *mid = calloc(len_mid_a + len_mid_b + 2 * n, 1);
+    naive_mul(mid, a, len_mid_a, b, len_mid_b, order);
+    assert (fp_poly_mulmid(&res, p, q, n, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, mid + n - 1, n);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    free(mid);
+
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    free(a);
+    free(b);
+    free(full);
+}
+
+static void hello_world_tests()
+{
+    // over F_5, (1 + 2x + 3x^2)(4 + x) = 4 + 4x + 4x^2 + 3x^3
+    fp_field_t *field = fp_poly_init_prime_field(5);
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1, 2, 3}, 3), *q = fp_poly_init_array((uint8_t[]) {4, 1}, 2), *res;
+    assert (fp_poly_mullow(&res, p, q, 2, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {4, 4}, 2);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mulhigh(&res, p, q, 2, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {4, 3}, 2);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mulhigh(&res, p, q, 4, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {0}, 1);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    // the middle product of length 2 is the coefficients of degree 1 and 2 of (1 + 2x + 3x^2)(4 + x)
+    assert (fp_poly_mulmid(&res, p, q, 2, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {4, 4}, 2);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mullow(&res, p, q, 0, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_mullow(&res, NULL, q, 2, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_mulhigh(&res, p, NULL, 2, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_mulmid(&res, p, q, 2, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // schoolbook and Karatsuba sizes, balanced and unbalanced
+    size_t sizes[][3] = {{1, 1, 1}, {5, 3, 4}, {40, 40, 40}, {64, 64, 64}, {100, 37, 80}, {37, 100, 120}, {257, 300, 301}, {500, 500, 999}, {1000, 999, 333}};
+    uint8_t orders[] = {2, 3, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++)
+            assert_truncated_products(sizes[j][0], sizes[j][1], sizes[j][2], field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "../../lib/include/fp_poly.h"
+
+static void assert_power(fp_poly_t *base, const char *exponent, uint8_t *expected, size_t len_expected, fp_field_t *field)
+{
+    mpz_t e;
+    mpz_init_set_str(e, exponent, 10);
+    fp_poly_t *res, *p_expected = fp_poly_init_array(expected, len_expected);
+    assert (fp_poly_powmod(&res, base, e, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(p_expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p_expected) == FP_POLY_E_SUCCESS);
+    mpz_clear(e);
+}
+
+static void hello_world_tests()
+{
+    // F_8 = F_2[x] / (1 + x + x^3)
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    fp_poly_t *x = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+    assert_power(x, "0", (uint8_t[]) {1}, 1, field);
+    assert_power(x, "1", (uint8_t[]) {0, 1}, 2, field);
+    assert_power(x, "3", (uint8_t[]) {1, 1}, 2, field);
+    assert_power(x, "7", (uint8_t[]) {1}, 1, field);
+    assert_power(x, "8", (uint8_t[]) {0, 1}, 2, field);
+    assert_power(x, "-1", (uint8_t[]) {1, 0, 1}, 3, field);
+    // x^(2^100) = x^(2^(100 mod 3)) = x^2
+    assert_power(x, "1267650600228229401496703205376", (uint8_t[]) {0, 0, 1}, 3, field);
+    assert (fp_poly_free(x) == FP_POLY_E_SUCCESS);
+
+    // a non reduced base: x^5 = 1 + x + x^2
+    x = fp_poly_init_array((uint8_t[]) {0, 0, 0, 0, 0, 1}, 6);
+    assert_power(x, "1", (uint8_t[]) {1, 1, 1}, 3, field);
+    assert (fp_poly_free(x) == FP_POLY_E_SUCCESS);
+
+    // the zero polynom
+    fp_poly_t *zero = fp_poly_init_array((uint8_t[]) {0}, 1);
+    assert_power(zero, "5", (uint8_t[]) {0}, 1, field);
+    mpz_t e;
+    mpz_init_set_si(e, -1);
+    fp_poly_t *res;
+    assert (fp_poly_powmod(&res, zero, e, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_poly_powmod(&res, NULL, e, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_powmod(&res, zero, e, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(zero) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{251^2} = F_251[x] / (1 + x^2): x^251 = -x and x^(2^64 + 1) = x
+    field = fp_poly_init_galois_field(251, fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3));
+    x = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+    assert_power(x, "251", (uint8_t[]) {0, 250}, 2, field);
+    assert_power(x, "18446744073709551617", (uint8_t[]) {0, 1}, 2, field);
+    assert (fp_poly_free(x) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{5^7} = F_5[x] / (2 + 4x + x^7): a^e matches repeated multiplications and a^(q - 1) = 1
+    field = fp_poly_init_galois_field(5, fp_poly_init_array((uint8_t[]) {2, 4, 0, 0, 0, 0, 0, 1}, 8));
+    for (size_t i = 0; i < 8; i++)
+    {
+        fp_poly_t *a = fp_poly_init_random(i + 3, field);
+        fp_poly_t *expected = fp_poly_init_array((uint8_t[]) {1}, 1), *tmp;
+        for (unsigned long k = 0; k <= 40; k++)
+        {
+            mpz_set_ui(e, k);
+            assert (fp_poly_powmod(&res, a, e, field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_mul_fq(&tmp, expected, a, field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+            expected = tmp;
+        }
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        mpz_ui_pow_ui(e, 5, 7);
+        mpz_sub_ui(e, e, 1);
+        mpz_mul_ui(e, e, 1000003);
+        expected = fp_poly_init_array((uint8_t[]) {1}, 1);
+        assert (fp_poly_powmod(&res, a, e, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    }
+    mpz_clear(e);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
+
+static void assert_reduce(uint8_t *f, size_t n, uint8_t order, uint8_t is_sparse)
+{
+    // the reduction modulo the prepared modulus gives the remainder of fp_poly_div()
+    fp_field_t *field = fp_poly_init_galois_field(order, fp_poly_init_array(f, n + 1)), *prime_field = fp_poly_init_prime_field(order);
+    assert (field->modulus != NULL);
+    assert ((field->modulus->sparse_terms != 0) == is_sparse);
+    for (size_t i = 0; i < 10; i++)
+    {
+        // up to several windows of 2n - 1 coefficients
+        size_t len = 1 + rand() % (4 * n);
+        uint8_t *a = malloc(len), *scratch = malloc(FP_POLY_MODULUS_SCRATCH(n));
+        for (size_t j = 0; j < len; j++)
+            a[j] = rand() % order;
+        fp_poly_t *p = fp_poly_init_array(a, len), *q, *r;
+        assert (fp_poly_modulus_reduce(a, len, scratch, field->modulus, order) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_div(&q, &r, p, field->irreducible_polynom, prime_field) == FP_POLY_E_SUCCESS);
+        assert_dense(r, a, len < n ? len : n);
+        assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(r) == FP_POLY_E_SUCCESS);
+        free(a);
+        free(scratch);
+    }
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(prime_field) == FP_POLY_E_SUCCESS);
+}
+
+static void assert_reduce_dense(size_t n, uint8_t order)
+{
+    // a random irreducible polynom with more terms than the sparse reduction handles
+    fp_field_t *prime_field = fp_poly_init_prime_field(order);
+    fp_poly_t *p = NULL;
+    do
+    {
+        if (p)
+            assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+        p = fp_poly_init_random_irreducible(n, prime_field);
+    } while (p->coeff->size <= FP_POLY_SPARSE_MODULUS_TERMS);
+    uint8_t *f = malloc(n + 1);
+    to_dense(f, n + 1, p);
+    assert_reduce(f, n, order, 0);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(prime_field) == FP_POLY_E_SUCCESS);
+    free(f);
+}
+
+int main()
+{
+    // fp_poly_div() is only exact for small orders (its products are computed on 8 bits)
+    uint8_t orders[] = {2, 3, 7};
+    // the Barrett reduction by windows, with schoolbook and Karatsuba products
+    size_t degrees[] = {7, 20, FP_POLY_KARATSUBA_THRESHOLD + 8, 100};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+        for (size_t j = 0; j < sizeof(degrees) / sizeof(degrees[0]); j++)
+            assert_reduce_dense(degrees[j], orders[i]);
+
+    // the sparse reduction: trinomials and pentanomials
+    uint8_t *f = calloc(128, 1);
+    // 1 + x + x^7 and 1 + x + x^127 over F_2
+    f[0] = f[1] = f[7] = 1;
+    assert_reduce(f, 7, 2, 1);
+    memset(f, 0, 128);
+    f[0] = f[1] = f[127] = 1;
+    assert_reduce(f, 127, 2, 1);
+    // 1 + x + x^3 + x^4 + x^8 over F_2
+    memset(f, 0, 128);
+    f[0] = f[1] = f[3] = f[4] = f[8] = 1;
+    assert_reduce(f, 8, 2, 1);
+    // 1 + 2x + x^3 over F_3 and 5 + x^3 over F_7 (not monic: 3 (5 + x^3) = 1 + 3x^3)
+    memset(f, 0, 128);
+    f[0] = 1;
+    f[1] = 2;
+    f[3] = 1;
+    assert_reduce(f, 3, 3, 1);
+    memset(f, 0, 128);
+    f[0] = 1;
+    f[3] = 3;
+    assert_reduce(f, 3, 7, 1);
+    free(f);
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+#include "../test_helpers.h"
+
+static fp_poly_t *random_sparse(uint8_t *dense, size_t len, size_t nb_terms, uint8_t order)
+{
+    // at most nb_terms random non zero terms, and a non zero leading coefficient
+    memset(dense, 0, len);
+    for (size_t i = 0; i < nb_terms; i++)
+        dense[rand() % len] = 1 + rand() % (order - 1);
+    dense[len - 1] = 1 + rand() % (order - 1);
+    return fp_poly_init_array(dense, len);
+}
+
+static void assert_sparse(size_t len_a, size_t nb_a, size_t len_b, size_t nb_b, fp_field_t *field)
+{
+    uint8_t order = field->order;
+    size_t len = len_a + len_b - 1;
+    uint8_t *a = malloc(len_a), *b = malloc(len_b), *expected = malloc(len), *actual = malloc(len), *rem = malloc(len);
+    fp_poly_t *p = random_sparse(a, len_a, nb_a, order), *q = random_sparse(b, len_b, nb_b, order), *res, *quotient, *remainder;
+
+    assert (fp_poly_mul_sparse(&res, p, q, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_degree(res) == len - 1);
+    naive_mul(expected, a, len_a, b, len_b, order);
+    to_dense(actual, len, res);
+    assert (memcmp(expected, actual, len) == 0);
+
+    // the product is exactly divisible by q, and p = quotient q + remainder
+    assert (fp_poly_div_sparse(&quotient, &remainder, res, q, field) == FP_POLY_E_SUCCESS);
+    to_dense(actual, len_a, quotient);
+    assert (fp_poly_degree(quotient) == len_a - 1 && memcmp(a, actual, len_a) == 0);
+    assert (fp_poly_degree(remainder) == 0 && remainder->coeff->head->coeff == 0);
+    assert (fp_poly_free(quotient) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(remainder) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_div_sparse(&quotient, &remainder, p, q, field) == FP_POLY_E_SUCCESS);
+    if (len_a < len_b)
+        assert (fp_poly_degree(quotient) == 0 && quotient->coeff->head->coeff == 0);
+    else
+        assert (fp_poly_degree(quotient) == len_a - len_b);
+    assert (fp_poly_degree(remainder) < len_b - 1 || (len_b == 1 && remainder->coeff->head->coeff == 0));
+    size_t len_quotient = fp_poly_degree(quotient) + 1;
+    uint8_t *dense_quotient = malloc(len_quotient);
+    to_dense(dense_quotient, len_quotient, quotient);
+    naive_mul(expected, dense_quotient, len_quotient, b, len_b, order);
+    to_dense(rem, len_b, remainder);
+    for (size_t i = 0; i < len_a; i++)
+        assert ((expected[i] * (i < len_quotient + len_b - 1) + (i < len_b ? rem[i] : 0)) % order == a[i]);
+    free(dense_quotient);
+
+    assert (fp_poly_free(quotient) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(remainder) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    free(a);
+    free(b);
+    free(expected);
+    free(actual);
+    free(rem);
+}
+
+static void hello_world_tests()
+{
+    // over F_3, (1 + x^100)(2 + x^100) = 2 + x^200 and (2 + x^200) / (1 + x^100) = (2 + x^100, 0)
+    fp_field_t *field = fp_poly_init_prime_field(3);
+    mpz_t index;
+    mpz_init(index);
+    mpz_setbit(index, 0);
+    mpz_setbit(index, 100);
+    fp_poly_t *p = fp_poly_init_mpz(index, list_create_from_array((uint8_t[]) {1, 1}, 2));
+    fp_poly_t *q = fp_poly_init_mpz(index, list_create_from_array((uint8_t[]) {2, 1}, 2));
+    fp_poly_t *res, *quotient, *remainder;
+    assert (fp_poly_mul_sparse(&res, p, q, field) == FP_POLY_E_SUCCESS);
+    mpz_set_ui(index, 1);
+    mpz_setbit(index, 200);
+    list_t *expected = list_create_from_array((uint8_t[]) {2, 1}, 2);
+    assert (fp_poly_assert_mpz(res, index, expected) == FP_POLY_E_SUCCESS);
+    assert (list_destroy(expected) == LIST_E_SUCCESS);
+    assert (fp_poly_div_sparse(&quotient, &remainder, res, p, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(q, quotient) == FP_POLY_E_SUCCESS);
+    expected = list_create_from_array((uint8_t[]) {0}, 1);
+    assert (fp_poly_assert_sizet(remainder, 1, expected) == FP_POLY_E_SUCCESS);
+    assert (list_destroy(expected) == LIST_E_SUCCESS);
+    assert (fp_poly_free(quotient) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(remainder) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // errors
+    fp_poly_t *zero = fp_poly_init_array((uint8_t[]) {0}, 1);
+    assert (fp_poly_mul_sparse(&res, zero, q, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(zero, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_div_sparse(&quotient, &remainder, p, zero, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_poly_mul_sparse(&res, NULL, q, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_mul_sparse(&res, p, q, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_div_sparse(&quotient, &remainder, p, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_div_sparse(&quotient, &remainder, p, q, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(zero) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random sparse polynoms
+    uint8_t orders[] = {2, 3, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        assert_sparse(1, 1, 1, 1, field);
+        assert_sparse(50, 50, 7, 7, field);
+        assert_sparse(7, 3, 50, 10, field);
+        assert_sparse(3000, 30, 2000, 20, field);
+        assert_sparse(20000, 100, 5000, 1, field);
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+
+    // thousand terms spread over a degree of 10^7, checked at every point of the field
+    field = fp_poly_init_prime_field(13);
+    uint8_t *dense = malloc(10000000);
+    p = random_sparse(dense, 10000000, 1000, 13);
+    q = random_sparse(dense, 5000000, 1000, 13);
+    free(dense);
+    assert (fp_poly_mul_sparse(&res, p, q, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_div_sparse(&quotient, &remainder, res, q, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(p, quotient) == FP_POLY_E_SUCCESS);
+    for (uint8_t x = 0; x < 13; x++)
+    {
+        uint8_t value_p, value_q, value_res, value_remainder;
+        assert (fp_poly_eval(&value_p, p, x, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_eval(&value_q, q, x, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_eval(&value_res, res, x, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_eval(&value_remainder, remainder, x, field) == FP_POLY_E_SUCCESS);
+        assert (value_res == value_p * value_q % 13 && value_remainder == 0);
+    }
+    assert (fp_poly_free(quotient) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(remainder) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    mpz_clear(index);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
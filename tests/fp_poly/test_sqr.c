@@ -0,0 +1,91 @@
+#include "../../lib/include/fp_poly.h"
+
+static void assert_sqr(fp_poly_t *a, fp_field_t *field)
+{
+    fp_poly_t *res, *expected;
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mul(&expected, a, a, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    // over F_2, (1 + x + x^3)^2 = 1 + x^2 + x^6
+    fp_field_t *field = fp_poly_init_prime_field(2);
+    fp_poly_t *a = fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4), *res;
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    fp_poly_t *expected = fp_poly_init_array((uint8_t[]) {1, 0, 1, 0, 0, 0, 1}, 7);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    // the coefficients are reduced modulo 2: (3 + x + 2x^2)^2 = 1 + x^2
+    a = fp_poly_init_array((uint8_t[]) {3, 1, 2}, 3);
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    expected = fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert_sqr(a, field);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    a = fp_poly_init_array((uint8_t[]) {2, 0, 4}, 3);
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    expected = fp_poly_init_array((uint8_t[]) {0}, 1);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    a = fp_poly_init_array((uint8_t[]) {0}, 1);
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(a, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_sqr(&res, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_sqr(&res, a, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // over F_7, (3 + 2x)^2 = 2 + 5x + 4x^2
+    field = fp_poly_init_prime_field(7);
+    a = fp_poly_init_array((uint8_t[]) {3, 2}, 2);
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    expected = fp_poly_init_array((uint8_t[]) {2, 5, 4}, 3);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // over F_251, (200 + 100x)^2 = 91 + 91x + 211x^2
+    field = fp_poly_init_prime_field(251);
+    a = fp_poly_init_array((uint8_t[]) {200, 100}, 2);
+    assert (fp_poly_sqr(&res, a, field) == FP_POLY_E_SUCCESS);
+    expected = fp_poly_init_array((uint8_t[]) {91, 91, 211}, 3);
+    assert (fp_poly_assert_equality(expected, res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // random polynoms (fp_poly_mul() handles products of coefficients below 256) on both sides of the Karatsuba threshold and across several limbs
+    uint8_t orders[] = {2, 3, 13};
+    size_t degrees[] = {0, 1, 7, 31, 63, 64, 100, 200};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(degrees) / sizeof(degrees[0]); j++)
+        {
+            a = fp_poly_init_random(degrees[j], field);
+            assert_sqr(a, field);
+            assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+        }
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
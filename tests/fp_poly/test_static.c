@@ -1,18 +1,11 @@
 #include "../../lib/include/fp_poly.h"
 #include "../../lib/src/fp_poly.c"
+#include "../test_helpers.h"
 
 int main()
 {
-    // fp_poly_is_unit
-    assert (fp_poly_is_unit(NULL) == 0);
-    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {1}, 1);
-    assert (fp_poly_is_unit(p) == 1);
-    list_add_beginning(p->coeff, 1);
-    assert (fp_poly_is_unit(p) == 0);
-    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
-
     // fp_poly_is_zero
-    p = fp_poly_init_array((uint8_t[]) {0}, 1);
+    fp_poly_t *p = fp_poly_init_array((uint8_t[]) {0}, 1);
     assert (fp_poly_is_zero(NULL) == 0);
     assert (fp_poly_is_zero(p) == 1);
     list_add_beginning(p->coeff, 1);
@@ -61,7 +54,57 @@ int main()
     //fp_poly_inv
     fp_field_t *field = fp_poly_init_prime_field(4);
     assert (fp_poly_inv(2, field) == 0);
+    assert (fp_poly_inv(3, field) == 3);
     assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_prime_field(251);
+    assert (field->inverse != NULL);
+    for (uint16_t a = 1; a < 251; a++)
+        assert ((uint16_t) a * fp_poly_inv(a, field) % 251 == 1);
+    assert (fp_poly_inv(0, field) == 0);
+    assert (fp_poly_inv(253, field) == fp_poly_inv(2, field));
+    assert (fp_poly_inv_euclid(3, 7) == 5);
+    assert (fp_poly_inv_euclid(6, 9) == 0);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // fp_poly_modulus_init
+    field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1}, 4));
+    assert (field->modulus != NULL);
+    assert (field->modulus->degree == 3);
+    assert (field->modulus->lc_inv == 1);
+    assert (field->modulus->inv_rev[0] == 1 && field->modulus->inv_rev[1] == 0);
+    assert (field->modulus->sparse_terms == 2);
+    uint8_t dense[5] = {1, 0, 0, 1, 1}, scratch[FP_POLY_MODULUS_SCRATCH(3)];
+    assert (fp_poly_modulus_reduce(dense, 5, scratch, field->modulus, field->order) == FP_POLY_E_SUCCESS);
+    assert (dense[0] == 0 && dense[1] == 0 && dense[2] == 1);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // fp_poly_dense_gcd_euclid
+    uint8_t orders[] = {2, 7};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < 100; j++)
+        {
+            // random operands (the second one non zero) below the threshold of the half-GCD
+            size_t len_a = 1 + rand() % FP_POLY_HGCD_THRESHOLD, len_b = 1 + rand() % FP_POLY_HGCD_THRESHOLD, len_gcd;
+            fp_poly_dense_t a = {len_a, malloc(len_a)}, b = {len_b, malloc(len_b)};
+            uint8_t *expected = malloc(len_a > len_b ? len_a : len_b);
+            for (size_t k = 0; k < len_a; k++)
+                a.coeff[k] = rand() % orders[i];
+            for (size_t k = 0; k < len_b; k++)
+                b.coeff[k] = rand() % orders[i];
+            b.coeff[len_b - 1] = 1 + rand() % (orders[i] - 1);
+            fp_poly_dense_normalise(&a);
+            len_gcd = naive_gcd(expected, a.coeff, a.len, b.coeff, b.len, orders[i]);
+            fp_poly_dense_gcd_euclid(&a, &b, field);
+            assert (a.len == len_gcd && b.len == 0);
+            assert (memcmp(a.coeff, expected, len_gcd) == 0);
+            free(a.coeff);
+            free(b.coeff);
+            free(expected);
+        }
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
 
     // fp_poly_parse
     assert (fp_poly_parse(NULL) == NULL);
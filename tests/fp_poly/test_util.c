@@ -33,8 +33,5 @@ int main()
     
     // fp_poly_degree
     assert (fp_poly_degree(NULL) == 0);
-
-    // fp_poly_is_unit
-    assert (fp_poly_is_unit(NULL) == 0);
     return 0;
 }
\ No newline at end of file
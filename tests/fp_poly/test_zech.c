@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include "../../lib/include/fp_poly.h"
+
+static uint16_t zech_from_array(uint8_t *a, size_t len, fp_field_t *field)
+{
+    uint16_t res;
+    fp_poly_t *p = fp_poly_init_array(a, len);
+    assert (fp_poly_zech_from_poly(&res, p, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    return res;
+}
+
+static void assert_zech_field(fp_field_t *field)
+{
+    size_t q = field->zech->size, n = field->modulus->degree;
+    uint8_t order = field->order;
+    mpz_t e;
+    mpz_init(e);
+    for (size_t t = 0; t < 200; t++)
+    {
+        uint16_t a = rand() % q, b = rand() % q, c;
+        fp_poly_t *p_a, *p_b, *p_c, *expected;
+        assert (fp_poly_zech_to_poly(&p_a, a, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_zech_to_poly(&p_b, b, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_zech_from_poly(&c, p_a, field) == FP_POLY_E_SUCCESS);
+        assert (c == a);
+
+        // the product matches fp_poly_mul_fq()
+        assert (fp_poly_mul_fq(&expected, p_a, p_b, field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_zech_to_poly(&p_c, fp_poly_zech_mul(a, b, field), field) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_assert_equality(expected, p_c) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(p_c) == FP_POLY_E_SUCCESS);
+
+        // the sum matches the sum of the coefficients
+        uint8_t sum[16] = {0};
+        for (size_t i = 0; i < n; i++)
+        {
+            list_node_t *node_a = mpz_tstbit(p_a->index_coeff, i) ? fp_poly_degree_to_node_list(p_a, i) : NULL;
+            list_node_t *node_b = mpz_tstbit(p_b->index_coeff, i) ? fp_poly_degree_to_node_list(p_b, i) : NULL;
+            sum[i] = ((node_a ? node_a->coeff : 0) + (node_b ? node_b->coeff : 0)) % order;
+        }
+        assert (fp_poly_zech_add(a, b, field) == zech_from_array(sum, n, field));
+
+        // the inverse and the powers match fp_poly_invmod() and fp_poly_powmod()
+        if (a != 0)
+        {
+            assert (fp_poly_invmod(&expected, p_a, field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_zech_to_poly(&p_c, fp_poly_zech_inv(a, field), field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_assert_equality(expected, p_c) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(p_c) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_zech_mul(a, fp_poly_zech_inv(a, field), field) == 1);
+        }
+        mpz_set_si(e, (long) (rand() % 1000) - 500);
+        if (a != 0 || mpz_sgn(e) > 0)
+        {
+            assert (fp_poly_powmod(&expected, p_a, e, field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_zech_to_poly(&p_c, fp_poly_zech_pow(a, e, field), field) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_assert_equality(expected, p_c) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(expected) == FP_POLY_E_SUCCESS);
+            assert (fp_poly_free(p_c) == FP_POLY_E_SUCCESS);
+        }
+        assert (fp_poly_free(p_a) == FP_POLY_E_SUCCESS);
+        assert (fp_poly_free(p_b) == FP_POLY_E_SUCCESS);
+    }
+    mpz_clear(e);
+}
+
+static void hello_world_tests()
+{
+    // F_4 = F_2[x] / (1 + x + x^2) with the generator x
+    fp_field_t *field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 1}, 3));
+    fp_poly_t *p;
+    uint16_t id;
+    assert (field->zech == NULL);
+    assert (fp_poly_zech_to_poly(&p, 1, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_zech_from_poly(&id, field->irreducible_polynom, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_zech_mul(2, 3, field) == 0);
+    assert (fp_poly_init_zech(field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_init_zech(field) == FP_POLY_E_SUCCESS);
+    assert (field->zech != NULL);
+    assert (field->zech->size == 4);
+    assert (memcmp(field->zech->log, (uint16_t[]) {0, 1, 2, 3}, 4 * sizeof(uint16_t)) == 0);
+    assert (memcmp(field->zech->exp, (uint16_t[]) {1, 2, 3}, 3 * sizeof(uint16_t)) == 0);
+    assert (memcmp(field->zech->zech, (uint16_t[]) {0, 3, 2}, 3 * sizeof(uint16_t)) == 0);
+    assert (zech_from_array((uint8_t[]) {1, 1}, 2, field) == 3);
+    assert (zech_from_array((uint8_t[]) {0, 0, 1}, 3, field) == 3);
+    assert (zech_from_array((uint8_t[]) {0}, 1, field) == 0);
+    assert (fp_poly_zech_add(2, 3, field) == 1);
+    assert (fp_poly_zech_mul(3, 3, field) == 2);
+    assert (fp_poly_zech_inv(2, field) == 3);
+    assert (fp_poly_zech_inv(0, field) == 0);
+    assert (fp_poly_zech_to_poly(&p, 4, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_poly_zech_from_poly(NULL, NULL, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // no tables for a prime field, a reducible modulus or a large field
+    assert (fp_poly_init_zech(NULL) == FP_POLY_E_FIELD_IS_NULL);
+    field = fp_poly_init_prime_field(7);
+    assert (fp_poly_init_zech(field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (field->zech == NULL);
+    assert (fp_poly_zech_to_poly(&p, 1, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3));
+    assert (fp_poly_init_zech(field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (field->zech == NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}, 18));
+    assert (fp_poly_init_zech(field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (field->zech == NULL);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    // F_{2^8} with the non primitive modulus of the AES, F_{3^5}, F_{2^16} and F_{251^2}
+    field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 1, 0, 1, 1, 0, 0, 0, 1}, 9));
+    assert (fp_poly_init_zech(field) == FP_POLY_E_SUCCESS);
+    assert (field->zech != NULL && field->zech->exp[1] != 2);
+    assert_zech_field(field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_galois_field(3, fp_poly_init_array((uint8_t[]) {1, 2, 0, 0, 0, 1}, 6));
+    assert (fp_poly_init_zech(field) == FP_POLY_E_SUCCESS);
+    assert (field->zech != NULL);
+    assert_zech_field(field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_galois_field(2, fp_poly_init_array((uint8_t[]) {1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}, 17));
+    assert (fp_poly_init_zech(field) == FP_POLY_E_SUCCESS);
+    assert (field->zech != NULL && field->zech->size == 65536);
+    assert_zech_field(field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    field = fp_poly_init_galois_field(251, fp_poly_init_array((uint8_t[]) {1, 0, 1}, 3));
+    assert (fp_poly_init_zech(field) == FP_POLY_E_SUCCESS);
+    assert (field->zech != NULL && field->zech->size == 63001);
+    assert_zech_field(field);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+    return 0;
+}
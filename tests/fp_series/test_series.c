@@ -0,0 +1,141 @@
+#include <assert.h>
+#include <stdlib.h>
+#include "../../lib/include/fp_series.h"
+#include "../test_helpers.h"
+
+static fp_poly_t *random_series(size_t n, uint8_t constant, fp_field_t *field)
+{
+    uint8_t *a = malloc(n);
+    for (size_t i = 0; i < n; i++)
+        a[i] = rand() % field->order;
+    a[0] = constant;
+    fp_poly_t *res = fp_poly_init_array(a, n);
+    free(a);
+    return res;
+}
+
+static void assert_inv(size_t n, fp_field_t *field)
+{
+    fp_poly_t *a = random_series(n, 1 + rand() % (field->order - 1), field), *inv, *prod;
+    assert (fp_series_inv(&inv, a, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mullow(&prod, a, inv, n, field) == FP_POLY_E_SUCCESS);
+    assert_dense(prod, (uint8_t[]) {1}, 1);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(inv) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(prod) == FP_POLY_E_SUCCESS);
+}
+
+static void assert_sqrt(size_t n, fp_field_t *field)
+{
+    uint8_t root = 1 + rand() % (field->order - 1);
+    fp_poly_t *a = random_series(n, root * root % field->order, field), *sqrt, *square;
+    assert (fp_series_sqrt(&sqrt, a, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_mullow(&square, sqrt, sqrt, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(a, square) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(sqrt) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(square) == FP_POLY_E_SUCCESS);
+}
+
+static void assert_log_exp(size_t n, fp_field_t *field)
+{
+    // exp(log(a)) = a and log(exp(b)) = b
+    fp_poly_t *a = random_series(n, 1, field), *b = random_series(n, 0, field), *log, *exp;
+    assert (fp_series_log(&log, a, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_series_exp(&exp, log, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(a, exp) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(log) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(exp) == FP_POLY_E_SUCCESS);
+    assert (fp_series_exp(&exp, b, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_series_log(&log, exp, n, field) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_assert_equality(b, log) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(log) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(exp) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(a) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(b) == FP_POLY_E_SUCCESS);
+}
+
+static void hello_world_tests()
+{
+    fp_field_t *field = fp_poly_init_prime_field(7);
+    fp_poly_t *p, *res;
+
+    // over F_7, 1 / (1 - x) = 1 + x + x^2 + x^3 mod x^4
+    p = fp_poly_init_array((uint8_t[]) {1, 6}, 2);
+    assert (fp_series_inv(&res, p, 4, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {1, 1, 1, 1}, 4);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+
+    // over F_7, sqrt(1 + x) = 1 + x/2 - x^2/8 + x^3/16 = 1 + 4x + 6x^2 + 4x^3 mod x^4
+    p = fp_poly_init_array((uint8_t[]) {1, 1}, 2);
+    assert (fp_series_sqrt(&res, p, 4, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {1, 4, 6, 4}, 4);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // over F_7, log(1 + x) = x - x^2/2 + x^3/3 - x^4/4 = x + 3x^2 + 5x^3 + 5x^4 mod x^5
+    assert (fp_series_log(&res, p, 5, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {0, 1, 3, 5, 5}, 5);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+
+    // over F_7, exp(x) = sum of x^k / k! = 1 + x + 4x^2 + 6x^3 + 5x^4 + x^5 + 6x^6 mod x^7
+    p = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+    assert (fp_series_exp(&res, p, 7, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {1, 1, 4, 6, 5, 1, 6}, 7);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // the coefficients of degree at least n are ignored
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {1, 6, 0, 0, 0, 0, 3}, 7);
+    assert (fp_series_inv(&res, p, 3, field) == FP_POLY_E_SUCCESS);
+    assert_dense(res, (uint8_t[]) {1, 1, 1}, 3);
+    assert (fp_poly_free(res) == FP_POLY_E_SUCCESS);
+
+    // error cases
+    assert (fp_series_inv(&res, NULL, 3, field) == FP_POLY_E_POLYNOM_IS_NULL);
+    assert (fp_series_inv(&res, p, 3, NULL) == FP_POLY_E_FIELD_IS_NULL);
+    assert (fp_series_inv(&res, p, 0, field) == FP_POLY_E_POLYNOM_MANIPULATION);
+    assert (fp_series_log(&res, p, 8, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_series_exp(&res, p, 3, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    p = fp_poly_init_array((uint8_t[]) {0, 1}, 2);
+    assert (fp_series_inv(&res, p, 3, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_series_log(&res, p, 3, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_series_sqrt(&res, p, 3, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    // 3 is not a square modulo 7
+    p = fp_poly_init_array((uint8_t[]) {3, 1}, 2);
+    assert (fp_series_sqrt(&res, p, 3, field) == FP_POLY_E_COEFFICIENT_ARITHMETIC);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+
+    field = fp_poly_init_prime_field(2);
+    p = fp_poly_init_array((uint8_t[]) {1, 1}, 2);
+    assert (fp_series_sqrt(&res, p, 3, field) == FP_POLY_E_FIELD_MANIPULATION);
+    assert (fp_poly_free(p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+}
+
+int main()
+{
+    hello_world_tests();
+
+    // precisions around the Karatsuba threshold and the Newton steps
+    size_t precisions[] = {1, 2, 3, 17, 64, 100, 251, 1000};
+    uint8_t orders[] = {2, 3, 251};
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++)
+    {
+        fp_field_t *field = fp_poly_init_prime_field(orders[i]);
+        for (size_t j = 0; j < sizeof(precisions) / sizeof(precisions[0]); j++)
+        {
+            assert_inv(precisions[j], field);
+            if (orders[i] != 2)
+                assert_sqrt(precisions[j], field);
+            if (precisions[j] <= orders[i])
+                assert_log_exp(precisions[j], field);
+        }
+        assert (fp_poly_free_field(field) == FP_POLY_E_SUCCESS);
+    }
+    return 0;
+}
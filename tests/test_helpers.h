@@ -0,0 +1,136 @@
+/**
+ * @file test_helpers.h
+ * @brief Naive reference implementations shared by the tests.
+ * @author Guillaume Roumage
+ * @date 04/2024
+*/
+
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+#include <assert.h>
+#include <stdlib.h>
+#include "../lib/include/fp_poly.h"
+
+/**
+ * @brief Compute x^e modulo order by repeated multiplications.
+ *
+ * @param x The base.
+ * @param e The exponent.
+ * @param order The order of the field.
+ *
+ * @return x^e modulo order.
+ */
+static inline uint8_t naive_pow(uint8_t x, size_t e, uint8_t order)
+{
+    uint16_t res = 1;
+    for (size_t i = 0; i < e; i++)
+        res = res * x % order;
+    return res;
+}
+
+/**
+ * @brief Multiply two dense polynoms with the schoolbook method.
+ *
+ * @param res The dense array which will store the product (len_a + len_b - 1 coefficients).
+ * @param a The first dense polynom.
+ * @param len_a The length of the first dense polynom.
+ * @param b The second dense polynom.
+ * @param len_b The length of the second dense polynom.
+ * @param order The order of the field.
+ */
+static inline void naive_mul(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, uint8_t order)
+{
+    memset(res, 0, len_a + len_b - 1);
+    for (size_t i = 0; i < len_a; i++)
+        if (a[i])
+            for (size_t j = 0; j < len_b; j++)
+                res[i + j] = (res[i + j] + a[i] * b[j]) % order;
+}
+
+/**
+ * @brief Write the coefficients of degree lower than len of a polynom into a dense array.
+ *
+ * @param dense The dense array (len coefficients).
+ * @param len The length of the dense array.
+ * @param p The polynom.
+ */
+static inline void to_dense(uint8_t *dense, size_t len, fp_poly_t *p)
+{
+    memset(dense, 0, len);
+    size_t degree = 0;
+    for (list_node_t *node = p->coeff->head; node != NULL; node = node->next, degree++)
+    {
+        degree = mpz_scan1(p->index_coeff, degree);
+        if (degree < len)
+            dense[degree] = node->coeff;
+    }
+}
+
+/**
+ * @brief Assert that a polynom is equal to a dense polynom, up to the leading zeros of the latter.
+ *
+ * @param p The polynom.
+ * @param expected The dense polynom.
+ * @param len The length of the dense polynom.
+ */
+static inline void assert_dense(fp_poly_t *p, const uint8_t *expected, size_t len)
+{
+    while (len > 1 && expected[len - 1] == 0)
+        len--;
+    fp_poly_t *q = fp_poly_init_array((uint8_t *) expected, len);
+    assert (fp_poly_assert_equality(q, p) == FP_POLY_E_SUCCESS);
+    assert (fp_poly_free(q) == FP_POLY_E_SUCCESS);
+}
+
+/**
+ * @brief Compute the monic greatest common divisor of two dense polynoms with the schoolbook Euclidean algorithm.
+ *
+ * @param res The dense array which will store the greatest common divisor (at least max(len_a, len_b) coefficients).
+ * @param a The first dense polynom.
+ * @param len_a The length of the first dense polynom.
+ * @param b The second dense polynom.
+ * @param len_b The length of the second dense polynom.
+ * @param order The order of the field (a prime number).
+ *
+ * @return The length of the greatest common divisor (0 if both polynoms are zero).
+ */
+static inline size_t naive_gcd(uint8_t *res, const uint8_t *a, size_t len_a, const uint8_t *b, size_t len_b, uint8_t order)
+{
+    size_t len = len_a > len_b ? len_a : len_b;
+    uint8_t *r0 = calloc(len, 1), *r1 = calloc(len, 1);
+    memcpy(r0, a, len_a);
+    memcpy(r1, b, len_b);
+    size_t len_r0 = len_a, len_r1 = len_b;
+    while (len_r0 > 0 && r0[len_r0 - 1] == 0)
+        len_r0--;
+    while (len_r1 > 0 && r1[len_r1 - 1] == 0)
+        len_r1--;
+    while (len_r1 > 0)
+    {
+        uint8_t lc_inv = naive_pow(r1[len_r1 - 1], order - 2, order);
+        for (size_t i = 0; i < len_r1; i++)
+            r1[i] = r1[i] * lc_inv % order;
+        while (len_r0 >= len_r1)
+        {
+            uint8_t minus_c = order - r0[len_r0 - 1];
+            size_t shift = len_r0 - len_r1;
+            for (size_t i = 0; i < len_r1; i++)
+                r0[shift + i] = (r0[shift + i] + minus_c * r1[i]) % order;
+            while (len_r0 > 0 && r0[len_r0 - 1] == 0)
+                len_r0--;
+        }
+        uint8_t *tmp = r0;
+        r0 = r1;
+        r1 = tmp;
+        size_t tmp_len = len_r0;
+        len_r0 = len_r1;
+        len_r1 = tmp_len;
+    }
+    memcpy(res, r0, len_r0);
+    free(r0);
+    free(r1);
+    return len_r0;
+}
+
+#endif //TEST_HELPERS_H